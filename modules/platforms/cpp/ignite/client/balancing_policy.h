@@ -0,0 +1,51 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::balancing_policy.
+ */
+
+#pragma once
+
+namespace ignite {
+
+/**
+ * Policy of choosing a connection for the requests that are not bound to a specific node.
+ *
+ * Requests within a transaction always use the connection of the transaction, and requests for a specific key
+ * prefer the connection to the node holding the primary replica of the key's partition.
+ */
+enum class balancing_policy {
+    /** Choose a random connection. */
+    RANDOM = 0,
+
+    /** Choose connections one after another. */
+    ROUND_ROBIN = 1,
+
+    /** Choose the connection with the least number of requests awaiting a response. */
+    LEAST_OUTSTANDING = 2,
+
+    /**
+     * Choose the connection with the least expected response time: the exponentially weighted moving average of
+     * the response latency multiplied by the number of requests awaiting a response plus one. Connections without
+     * responses yet are assumed to have the average latency of the other connections.
+     */
+    LATENCY_WEIGHTED = 3,
+};
+
+} // namespace ignite
@@ -0,0 +1,68 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * @file
+ * Declares ignite::callback_executor.
+ */
+
+#pragma once
+
+#include "ignite/common/detail/config.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace ignite {
+
+/**
+ * Executor of the user callbacks.
+ *
+ * When set in the client configuration, responses are still decoded on the client IO threads, while the callbacks
+ * passed to the asynchronous API are invoked by the executor. This way a slow callback does not stall the receiving
+ * of responses over all the connections served by the IO thread.
+ */
+class callback_executor {
+public:
+    // Default
+    virtual ~callback_executor() = default;
+
+    /**
+     * Schedule execution of the task.
+     *
+     * Called from the client IO threads, so it should not block. If the task can not be scheduled, an exception
+     * should be thrown, in which case the task is executed in place.
+     *
+     * @param task Task.
+     */
+    virtual void execute(std::function<void()> task) = 0;
+
+    /**
+     * Make the built-in work-stealing thread pool executor.
+     *
+     * Tasks scheduled from the pool threads are put to the queue of the current thread, other tasks are distributed
+     * between the threads round-robin. Idle threads take tasks from the queues of the busy ones.
+     *
+     * @param threads Number of threads. Zero means the number of hardware threads.
+     * @return Executor. Threads are stopped when the executor is destroyed.
+     */
+    [[nodiscard]] IGNITE_API static std::shared_ptr<callback_executor> make_thread_pool(std::uint32_t threads);
+};
+
+} // namespace ignite
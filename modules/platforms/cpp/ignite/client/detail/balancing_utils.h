@@ -0,0 +1,132 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Find the connection with the least score.
+ *
+ * The scan starts from the specified position, so ties are not always resolved in favor of the same connection, and
+ * stops early once a connection with the least possible score, the default constructed one, is found.
+ *
+ * @tparam C Connection type.
+ * @tparam F Score function type.
+ * @param channels Connections. Must not be empty.
+ * @param start Position to start from. Taken modulo the number of connections.
+ * @param score Function calculating a score of the connection.
+ * @return Index of the connection.
+ */
+template<typename C, typename F>
+std::size_t find_least_channel(const std::vector<std::shared_ptr<C>> &channels, std::size_t start, F score) {
+    using score_type = decltype(score(*channels.front()));
+
+    auto size = channels.size();
+    start %= size;
+
+    auto best = start;
+    auto best_score = score(*channels[start]);
+    for (std::size_t i = 1; i < size && score_type{} < best_score; ++i) {
+        auto idx = (start + i) % size;
+        auto idx_score = score(*channels[idx]);
+        if (idx_score < best_score) {
+            best = idx;
+            best_score = idx_score;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * Find the connection with the least number of requests awaiting a response.
+ *
+ * @tparam C Connection type.
+ * @param channels Connections. Must not be empty.
+ * @param start Position to start from.
+ * @return Index of the connection.
+ */
+template<typename C>
+std::size_t find_least_outstanding_channel(const std::vector<std::shared_ptr<C>> &channels, std::size_t start) {
+    return find_least_channel(channels, start, [](const C &channel) { return channel.get_outstanding_requests(); });
+}
+
+/**
+ * Find the connection with the least expected latency: the average latency multiplied by the number of requests
+ * queued before the new one.
+ *
+ * Connections which did not respond yet have no latency samples. They are scored with the average latency of the
+ * other connections, so they are neither preferred nor avoided. Ties are broken by the number of outstanding requests.
+ *
+ * @tparam C Connection type.
+ * @param channels Connections. Must not be empty.
+ * @param start Position to start from.
+ * @return Index of the connection.
+ */
+template<typename C>
+std::size_t find_latency_weighted_channel(const std::vector<std::shared_ptr<C>> &channels, std::size_t start) {
+    std::uint64_t total_latency = 0;
+    std::uint64_t sampled = 0;
+    for (const auto &channel : channels) {
+        auto latency = std::chrono::nanoseconds(channel->get_average_latency()).count();
+        if (latency > 0) {
+            total_latency += std::uint64_t(latency);
+            ++sampled;
+        }
+    }
+
+    // Without any samples, only the outstanding requests are compared.
+    std::uint64_t fallback = sampled ? std::max(total_latency / sampled, std::uint64_t(1)) : 1;
+
+    return find_least_channel(channels, start, [fallback](const C &channel) {
+        auto latency = std::chrono::nanoseconds(channel.get_average_latency()).count();
+        auto outstanding = std::uint64_t(channel.get_outstanding_requests());
+
+        auto expected = (latency > 0 ? std::uint64_t(latency) : fallback) * (outstanding + 1);
+        return std::make_pair(expected, outstanding);
+    });
+}
+
+/**
+ * Get the connections except the one with the specified ID. Used to send a retried request over another connection
+ * than the failed one.
+ *
+ * @tparam C Connection type.
+ * @param channels Connections.
+ * @param id ID of the connection to skip.
+ * @return Other connections. All the connections if there are no others.
+ */
+template<typename C>
+std::vector<std::shared_ptr<C>> without_channel(const std::vector<std::shared_ptr<C>> &channels, std::uint64_t id) {
+    std::vector<std::shared_ptr<C>> res;
+    res.reserve(channels.size());
+    std::copy_if(channels.begin(), channels.end(), std::back_inserter(res),
+        [id](const std::shared_ptr<C> &channel) { return channel->id() != id; });
+
+    return res.empty() ? channels : res;
+}
+
+} // namespace ignite::detail
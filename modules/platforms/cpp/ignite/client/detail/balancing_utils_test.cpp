@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/balancing_utils.h"
+
+#include <gtest/gtest.h>
+
+using namespace ignite::detail;
+
+namespace {
+
+/**
+ * Connection with the given statistics.
+ */
+struct test_channel {
+    /** Average latency. Zero if there are no samples. */
+    std::chrono::nanoseconds latency{0};
+
+    /** Number of outstanding requests. */
+    std::size_t outstanding{0};
+
+    /** Connection ID. */
+    std::uint64_t channel_id{0};
+
+    [[nodiscard]] std::uint64_t id() const { return channel_id; }
+
+    [[nodiscard]] std::chrono::nanoseconds get_average_latency() const { return latency; }
+
+    [[nodiscard]] std::size_t get_outstanding_requests() const { return outstanding; }
+};
+
+/**
+ * Make connections.
+ *
+ * @param stats Latencies in milliseconds and numbers of outstanding requests.
+ * @return Connections.
+ */
+std::vector<std::shared_ptr<test_channel>> make_channels(
+    std::initializer_list<std::pair<std::int64_t, std::size_t>> stats) {
+    std::vector<std::shared_ptr<test_channel>> res;
+    for (auto [latency_ms, outstanding] : stats)
+        res.push_back(std::make_shared<test_channel>(test_channel{std::chrono::milliseconds(latency_ms), outstanding}));
+
+    return res;
+}
+
+} // namespace
+
+TEST(balancing_utils, least_outstanding) {
+    auto channels = make_channels({{0, 3}, {0, 1}, {0, 2}});
+
+    for (std::size_t start = 0; start < 6; ++start)
+        EXPECT_EQ(1, find_least_outstanding_channel(channels, start)) << "start=" << start;
+}
+
+TEST(balancing_utils, least_outstanding_ties_depend_on_start) {
+    auto channels = make_channels({{0, 0}, {0, 0}, {0, 5}});
+
+    EXPECT_EQ(0, find_least_outstanding_channel(channels, 0));
+    EXPECT_EQ(1, find_least_outstanding_channel(channels, 1));
+    EXPECT_EQ(0, find_least_outstanding_channel(channels, 2));
+}
+
+TEST(balancing_utils, latency_weighted_prefers_faster) {
+    // 10ms * 3 = 30ms, 40ms * 1 = 40ms, 5ms * 7 = 35ms.
+    auto channels = make_channels({{10, 2}, {40, 0}, {5, 6}});
+
+    for (std::size_t start = 0; start < 3; ++start)
+        EXPECT_EQ(0, find_latency_weighted_channel(channels, start)) << "start=" << start;
+}
+
+TEST(balancing_utils, latency_weighted_new_connection_uses_average) {
+    // The connection without samples is scored with the 20ms average: 20ms * 3 = 60ms.
+    auto channels = make_channels({{0, 2}, {10, 4}, {30, 0}});
+
+    for (std::size_t start = 0; start < 3; ++start)
+        EXPECT_EQ(2, find_latency_weighted_channel(channels, start)) << "start=" << start;
+
+    // A new connection is chosen when it is actually expected to respond faster: 20ms * 1 = 20ms.
+    channels[0]->outstanding = 0;
+    channels[2]->outstanding = 1;
+    for (std::size_t start = 0; start < 3; ++start)
+        EXPECT_EQ(0, find_latency_weighted_channel(channels, start)) << "start=" << start;
+}
+
+TEST(balancing_utils, latency_weighted_stalled_connection_is_not_preferred) {
+    // A connection which did not answer the first requests yet has no samples, but keeps accumulating requests.
+    auto channels = make_channels({{0, 50}, {10, 1}, {10, 2}});
+
+    for (std::size_t start = 0; start < 3; ++start)
+        EXPECT_EQ(1, find_latency_weighted_channel(channels, start)) << "start=" << start;
+}
+
+TEST(balancing_utils, latency_weighted_without_samples_uses_outstanding) {
+    auto channels = make_channels({{0, 3}, {0, 1}, {0, 2}});
+
+    for (std::size_t start = 0; start < 3; ++start)
+        EXPECT_EQ(1, find_latency_weighted_channel(channels, start)) << "start=" << start;
+}
+
+TEST(balancing_utils, latency_weighted_ties_broken_by_outstanding) {
+    // 10ms * 4 = 40ms and 20ms * 2 = 40ms: the connection with fewer outstanding requests wins.
+    auto channels = make_channels({{10, 3}, {20, 1}});
+
+    EXPECT_EQ(1, find_latency_weighted_channel(channels, 0));
+    EXPECT_EQ(1, find_latency_weighted_channel(channels, 1));
+}
+
+TEST(balancing_utils, without_channel_skips_failed) {
+    auto channels = make_channels({{0, 0}, {0, 0}, {0, 0}});
+    for (std::size_t i = 0; i < channels.size(); ++i)
+        channels[i]->channel_id = i + 1;
+
+    auto others = without_channel(channels, 2);
+
+    ASSERT_EQ(2, others.size());
+    EXPECT_EQ(1, others[0]->id());
+    EXPECT_EQ(3, others[1]->id());
+}
+
+TEST(balancing_utils, without_channel_keeps_the_only_one) {
+    auto channels = make_channels({{0, 0}});
+    channels[0]->channel_id = 1;
+
+    auto others = without_channel(channels, 1);
+
+    ASSERT_EQ(1, others.size());
+    EXPECT_EQ(1, others[0]->id());
+}
@@ -16,7 +16,9 @@
  */
 
 #include "ignite/client/detail/cluster_connection.h"
+#include "ignite/client/detail/balancing_utils.h"
 #include "ignite/client/detail/logger_wrapper.h"
+#include "ignite/client/detail/utils.h"
 
 #include "ignite/network/codec.h"
 #include "ignite/network/codec_data_filter.h"
@@ -25,15 +27,235 @@
 #include "ignite/network/ssl/secure_data_filter.h"
 #include "ignite/protocol/writer.h"
 
-#include <iterator>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <unordered_set>
+#include <utility>
 
 namespace ignite::detail {
 
+namespace {
+
+/** Number of slots in the retry wheel. */
+constexpr std::size_t RETRY_WHEEL_SLOTS = 64;
+
+/** Number of slots in the wheel of scheduled functions. */
+constexpr std::size_t TIMER_WHEEL_SLOTS = 64;
+
+/** Whether the current thread is handling an IO event. */
+thread_local bool handling_io_event{false};
+
+/**
+ * Marks the current thread as handling an IO event for the lifetime of the object.
+ */
+class io_event_scope {
+public:
+    // Deleted
+    io_event_scope(const io_event_scope &) = delete;
+    io_event_scope &operator=(const io_event_scope &) = delete;
+
+    /**
+     * Constructor.
+     */
+    io_event_scope()
+        : m_prev(handling_io_event) {
+        handling_io_event = true;
+    }
+
+    /**
+     * Destructor.
+     */
+    ~io_event_scope() { handling_io_event = m_prev; }
+
+private:
+    /** Previous value of the flag. */
+    const bool m_prev;
+};
+
+} // namespace
+
+/**
+ * Response handler re-sending failed requests according to the retry policy.
+ *
+ * The request is encoded once, so it can be re-sent when the data it was created from is no longer available.
+ */
+class cluster_connection::retry_handler final : public response_handler,
+                                                public std::enable_shared_from_this<retry_handler> {
+public:
+    /**
+     * Constructor.
+     *
+     * @param connection Cluster connection.
+     * @param op Operation code.
+     * @param payload Encoded request.
+     * @param handler Handler of the request.
+     * @param preferred_node Name of the node that should preferably be used to perform the request.
+     * @param timeout Timeout of the operation, including all the attempts. Zero means no timeout.
+     */
+    retry_handler(std::weak_ptr<cluster_connection> connection, protocol::client_operation op,
+        std::vector<std::byte> payload, std::shared_ptr<response_handler> handler,
+        std::optional<std::string> preferred_node, std::chrono::milliseconds timeout)
+        : m_connection(std::move(connection))
+        , m_op(op)
+        , m_payload(std::move(payload))
+        , m_handler(std::move(handler))
+        , m_preferred_node(std::move(preferred_node)) {
+        if (timeout.count() > 0)
+            m_deadline = std::chrono::steady_clock::now() + timeout;
+        else
+            m_timeout = timeout;
+    }
+
+    /**
+     * Handle response.
+     *
+     * @param channel Channel.
+     * @param msg Message.
+     * @param flags Flags.
+     */
+    [[nodiscard]] ignite_result<void> handle(
+        std::shared_ptr<node_connection> channel, bytes_view msg, std::int32_t flags) override {
+        m_responded = true;
+
+        auto res = m_handler->handle(std::move(channel), msg, flags);
+        m_handling_complete = m_handler->is_handling_complete();
+        return res;
+    }
+
+    /**
+     * Set error. Schedules re-sending of the request instead if the retry policy allows it.
+     *
+     * @param err Error to set.
+     */
+    [[nodiscard]] ignite_result<void> set_error(ignite_error err) override {
+        m_handling_complete = true;
+
+        // Requests which started receiving responses are not replayed.
+        auto connection = m_connection.lock();
+        if (!connection || m_responded)
+            return m_handler->set_error(std::move(err));
+
+        ++m_attempt;
+
+        const auto &policy = connection->m_configuration.get_retry_policy();
+        auto retry = result_of_operation<bool>([&]() {
+            return policy.should_retry({client_operation_type(m_op), m_attempt, err});
+        });
+
+        if (retry.has_error()) {
+            connection->m_logger->log_error("Uncaught retry predicate exception: " + retry.error().what_str());
+            return m_handler->set_error(std::move(err));
+        }
+
+        if (!retry.value())
+            return m_handler->set_error(std::move(err));
+
+        // The timeout bounds the whole operation, so an attempt is not started if it can not complete in time.
+        auto backoff = policy.get_backoff(m_attempt);
+        if (m_deadline && std::chrono::steady_clock::now() + backoff >= *m_deadline)
+            return m_handler->set_error(std::move(err));
+
+        // The retry goes to another connection if there is one, whichever node was preferred.
+        m_failed_channel = m_channel;
+        m_preferred_node.reset();
+
+        if (connection->m_logger->is_debug_enabled()) {
+            connection->m_logger->log_debug("Retrying request: op=" + std::to_string(int(m_op))
+                + ", attempt=" + std::to_string(m_attempt) + ", error=" + err.what_str());
+        }
+
+        connection->schedule_retry(shared_from_this(), backoff);
+        return {};
+    }
+
+    /**
+     * Set the executor to invoke the callback on.
+     *
+     * @param executor Executor.
+     */
+    void set_executor(std::shared_ptr<callback_executor> executor) override { m_handler->set_executor(executor); }
+
+    /**
+     * Send the request.
+     *
+     * @param connection Cluster connection.
+     * @throw ignite_error if there are no connections.
+     */
+    void send(cluster_connection &connection) {
+        m_handling_complete = false;
+
+        // Every attempt only gets the time left of the operation timeout.
+        if (m_deadline) {
+            auto left = std::chrono::ceil<std::chrono::milliseconds>(*m_deadline - std::chrono::steady_clock::now());
+            m_timeout = std::max(left, std::chrono::milliseconds(1));
+        }
+
+        m_channel = connection.send_request(
+            m_op, [this](protocol::writer &writer) { writer.write_raw(m_payload); }, shared_from_this(),
+            m_preferred_node, m_failed_channel);
+    }
+
+    /**
+     * Re-send the request, handling the absence of connections as a failed attempt.
+     *
+     * @param connection Cluster connection.
+     */
+    void resend(cluster_connection &connection) {
+        try {
+            send(connection);
+        } catch (const ignite_error &err) {
+            auto res = set_error(err);
+            if (res.has_error())
+                connection.m_logger->log_error("Uncaught user callback exception: " + res.error().what_str());
+        }
+    }
+
+    /**
+     * Fail the request without retrying.
+     *
+     * @param err Error.
+     */
+    [[nodiscard]] ignite_result<void> fail(ignite_error err) { return m_handler->set_error(std::move(err)); }
+
+private:
+    /** Cluster connection. */
+    std::weak_ptr<cluster_connection> m_connection;
+
+    /** Operation code. */
+    const protocol::client_operation m_op;
+
+    /** Encoded request. */
+    const std::vector<std::byte> m_payload;
+
+    /** Handler of the request. */
+    const std::shared_ptr<response_handler> m_handler;
+
+    /** Name of the node that should preferably be used to perform the request. Reset after the first failure. */
+    std::optional<std::string> m_preferred_node;
+
+    /** ID of the connection the last attempt was sent over. */
+    std::optional<std::uint64_t> m_channel;
+
+    /** ID of the connection the last failed attempt was sent over. Skipped by the retries if there are others. */
+    std::optional<std::uint64_t> m_failed_channel;
+
+    /** Deadline of the operation. Not set if there is no timeout. */
+    std::optional<std::chrono::steady_clock::time_point> m_deadline;
+
+    /** Number of failed attempts. */
+    std::int32_t m_attempt{0};
+
+    /** Whether a response was received. */
+    bool m_responded{false};
+};
+
 cluster_connection::cluster_connection(ignite_client_configuration configuration)
     : m_configuration(std::move(configuration))
     , m_pool()
     , m_logger(std::make_shared<logger_wrapper>(m_configuration.get_logger()))
-    , m_generator(std::random_device()()) {
+    , m_retries(network::async_handler::TIMER_TICK_INTERVAL, RETRY_WHEEL_SLOTS)
+    , m_timers(network::async_handler::TIMER_TICK_INTERVAL, TIMER_WHEEL_SLOTS) {
 }
 
 void cluster_connection::start_async(std::function<void(ignite_result<void>)> callback) {
@@ -42,14 +264,17 @@ void cluster_connection::start_async(std::function<void(ignite_result<void>)> ca
     if (m_pool)
         throw ignite_error("Client is already started");
 
+    // The pool establishes a connection per listed address, so every address is listed once per connection.
+    auto per_node = get_connections_per_node();
+
     std::vector<tcp_range> addrs;
-    addrs.reserve(m_configuration.get_endpoints().size());
+    addrs.reserve(m_configuration.get_endpoints().size() * per_node);
     for (const auto &str_addr : m_configuration.get_endpoints()) {
         std::optional<tcp_range> ep = tcp_range::parse(str_addr, DEFAULT_TCP_PORT);
         if (!ep)
             throw ignite_error("Can not parse address range: " + str_addr);
 
-        addrs.push_back(std::move(ep.value()));
+        addrs.insert(addrs.end(), per_node, *ep);
     }
 
     data_filters filters;
@@ -70,9 +295,14 @@ void cluster_connection::start_async(std::function<void(ignite_result<void>)> ca
     std::shared_ptr<codec_data_filter> codec_filter(new network::codec_data_filter(codec_factory));
     filters.push_back(codec_filter);
 
-    m_pool = network::make_async_client_pool(filters);
+    m_pool = network::make_async_client_pool(filters, m_configuration.get_io_threads());
 
     m_pool->set_handler(shared_from_this());
+    m_pool->set_write_combining(
+        m_configuration.get_write_combining_delay(), m_configuration.get_write_combining_threshold());
+    m_pool->set_event_polling(m_configuration.is_edge_triggered_io(), m_configuration.get_max_io_events());
+    m_pool->set_io_uring_enabled(m_configuration.is_io_uring_enabled());
+    m_pool->set_busy_poll(m_configuration.get_busy_poll_duration(), m_configuration.is_low_latency_socket_options());
 
     m_on_initial_connect = std::move(callback);
 
@@ -83,21 +313,50 @@ void cluster_connection::stop() {
     auto pool = m_pool;
     if (pool)
         pool->stop();
+
+    std::vector<std::shared_ptr<retry_handler>> retries;
+    {
+        std::lock_guard<std::mutex> lock(m_retries_mutex);
+        m_retries.clear([&retries](std::shared_ptr<retry_handler> handler) { retries.push_back(std::move(handler)); });
+    }
+
+    for (auto &handler : retries) {
+        auto res = handler->fail(ignite_error(error::code::CONNECTION, "Client is stopped"));
+        if (res.has_error())
+            m_logger->log_error("Uncaught user callback exception: " + res.error().what_str());
+    }
+
+    // Released after the lock, as the functions can hold the last references to their owners.
+    std::vector<std::function<void()>> timers;
+    {
+        std::lock_guard<std::mutex> lock(m_timers_mutex);
+        m_timers.clear([&timers](std::function<void()> func) { timers.push_back(std::move(func)); });
+    }
 }
 
 void cluster_connection::on_connection_success(const end_point &addr, uint64_t id) {
+    io_event_scope scope;
+
     m_logger->log_info("Established connection with remote host " + addr.to_string());
     m_logger->log_debug("Connection ID: " + std::to_string(id));
 
-    auto connection = node_connection::make_new(id, m_pool, weak_from_this(), m_logger, m_configuration);
-    {
-        [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+    auto connection = node_connection::make_new(id, addr, m_pool, weak_from_this(), m_logger, m_configuration);
+    bool was_new = true;
+    update_connections([&](connections_snapshot &connections) {
+        was_new = connections.by_id.insert_or_assign(id, connection).second;
+        if (!was_new) {
+            auto &channels = connections.channels;
+            channels.erase(std::remove_if(channels.begin(), channels.end(),
+                               [id](const auto &channel) { return channel->id() == id; }),
+                channels.end());
+        }
 
-        auto [_it, was_new] = m_connections.insert_or_assign(id, connection);
-        if (!was_new)
-            m_logger->log_error(
-                "Unknown error: connecting is already in progress. Connection ID: " + std::to_string(id));
-    }
+        connections.channels.push_back(connection);
+        return true;
+    });
+
+    if (!was_new)
+        m_logger->log_error("Unknown error: connecting is already in progress. Connection ID: " + std::to_string(id));
 
     try {
         bool res = connection->handshake();
@@ -114,19 +373,32 @@ void cluster_connection::on_connection_success(const end_point &addr, uint64_t i
 }
 
 void cluster_connection::on_connection_error(const end_point &addr, ignite_error err) {
+    io_event_scope scope;
+
     m_logger->log_warning(
         "Failed to establish connection with remote host " + addr.to_string() + ", reason: " + err.what());
 
+    verify_discovered_address(addr, nullptr);
+
     if (err.get_status_code() == error::code::INTERNAL)
         initial_connect_result(std::move(err));
 }
 
 void cluster_connection::on_connection_closed(uint64_t id, std::optional<ignite_error> err) {
+    io_event_scope scope;
+
     m_logger->log_debug("Closed Connection ID " + std::to_string(id) + ", error=" + (err ? err->what() : "none"));
+
+    auto connection = find_client(id);
+    if (connection && !connection->is_handshake_complete())
+        verify_discovered_address(connection->get_address(), nullptr);
+
     remove_client(id);
 }
 
 void cluster_connection::on_message_received(uint64_t id, bytes_view msg) {
+    io_event_scope scope;
+
     if (m_logger->is_debug_enabled())
         m_logger->log_debug("Message on Connection ID " + std::to_string(id) + ", size: " + std::to_string(msg.size()));
 
@@ -148,8 +420,31 @@ void cluster_connection::on_message_received(uint64_t id, bytes_view msg) {
 
     auto current_cluster_id = m_cluster_id;
     auto &context = connection->get_protocol_context();
+    if (verify_discovered_address(connection->get_address(), &context.get_node_name())) {
+        remove_client(connection->id());
+        m_pool->close(connection->id(), ignite_error(error::code::CONNECTION, "Unexpected node at discovered address"));
+        return;
+    }
+
     initial_connect_result(context);
 
+    if (!context.get_node_name().empty()) {
+        update_connections([&connection, &context](connections_snapshot &connections) {
+            // The connection could have been closed in the meantime.
+            if (connections.by_id.count(connection->id()) == 0)
+                return false;
+
+            connections.by_node[context.get_node_name()].push_back(connection);
+            return true;
+        });
+    }
+
+    // Discover the topology on the next timer tick after the first connection is established.
+    if (m_configuration.is_topology_discovery_enabled() && !m_topology_refresh_in_progress.load()) {
+        auto next = std::numeric_limits<std::int64_t>::max();
+        m_next_topology_refresh.compare_exchange_strong(next, 0);
+    }
+
     if (!current_cluster_id) {
         // No need to verify cluster ID here -- we're connecting for the first time
         return;
@@ -173,20 +468,204 @@ void cluster_connection::on_message_received(uint64_t id, bytes_view msg) {
 }
 
 std::shared_ptr<node_connection> cluster_connection::find_client(uint64_t id) {
-    [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+    auto connections = get_connections();
 
-    auto it = m_connections.find(id);
-    if (it != m_connections.end())
+    auto it = connections->by_id.find(id);
+    if (it != connections->by_id.end())
         return it->second;
 
     return {};
 }
 
+template<typename F>
+void cluster_connection::update_connections(F func) {
+    // Released after the lock, as destroying the last reference to a connection fails its pending requests.
+    std::shared_ptr<const connections_snapshot> old;
+
+    std::lock_guard<std::mutex> lock(m_connections_mutex);
+
+    auto current = get_connections();
+    auto connections = std::make_shared<connections_snapshot>(*current);
+    if (!func(*connections))
+        return;
+
+    std::lock_guard<std::mutex> ref_lock(m_connections_ref_mutex);
+    old = std::exchange(m_connections, std::move(connections));
+}
+
 void cluster_connection::on_message_sent(uint64_t id) {
     if (m_logger->is_debug_enabled())
         m_logger->log_debug("Message sent successfully on Connection ID " + std::to_string(id));
 }
 
+void cluster_connection::on_timer_tick() {
+    io_event_scope scope;
+
+    auto connections = get_connections();
+    auto now = std::chrono::steady_clock::now();
+
+    for (auto &channel : connections->channels)
+        channel->on_timer_tick(now);
+
+    std::vector<std::shared_ptr<retry_handler>> retries;
+    {
+        std::lock_guard<std::mutex> lock(m_retries_mutex);
+        m_retries.expire(now, [&retries](std::shared_ptr<retry_handler> handler) {
+            retries.push_back(std::move(handler));
+        });
+    }
+
+    for (auto &handler : retries)
+        handler->resend(*this);
+
+    std::vector<std::function<void()>> timers;
+    {
+        std::lock_guard<std::mutex> lock(m_timers_mutex);
+        m_timers.expire(now, [&timers](std::function<void()> func) { timers.push_back(std::move(func)); });
+    }
+
+    for (auto &func : timers) {
+        auto res = result_of_operation<void>(func);
+        if (res.has_error())
+            m_logger->log_error("Uncaught timer function exception: " + res.error().what_str());
+    }
+
+    bool refresh_due = now.time_since_epoch().count() >= m_next_topology_refresh.load();
+    if (refresh_due && !m_topology_refresh_in_progress.exchange(true))
+        refresh_topology();
+}
+
+void cluster_connection::refresh_topology() {
+    auto next = std::chrono::steady_clock::now() + m_configuration.get_topology_refresh_interval();
+    m_next_topology_refresh.store(next.time_since_epoch().count());
+
+    std::weak_ptr<cluster_connection> self_weak = weak_from_this();
+    auto callback = [self_weak](ignite_result<std::vector<cluster_node>> &&res) {
+        auto self = self_weak.lock();
+        if (!self)
+            return;
+
+        self->m_topology_refresh_in_progress.store(false);
+        if (res.has_error()) {
+            self->m_logger->log_warning("Failed to refresh topology: " + res.error().what_str());
+            return;
+        }
+
+        self->on_topology_received(res.value());
+    };
+
+    try {
+        perform_request_rd<std::vector<cluster_node>>(
+            protocol::client_operation::CLUSTER_GET_NODES, read_cluster_nodes, std::move(callback));
+    } catch (const ignite_error &err) {
+        m_topology_refresh_in_progress.store(false);
+        m_logger->log_warning("Failed to refresh topology: " + err.what_str());
+    }
+}
+
+void cluster_connection::on_topology_received(const std::vector<cluster_node> &nodes) {
+    auto connections = get_connections();
+
+    auto per_node = get_connections_per_node();
+
+    std::vector<network::tcp_range> added;
+    std::vector<network::tcp_range> removed;
+    {
+        std::lock_guard<std::mutex> lock(m_discovery_mutex);
+
+        if (!m_client_port_offset) {
+            for (const auto &node : nodes) {
+                auto it = connections->by_node.find(node.get_name());
+                if (it == connections->by_node.end() || it->second.empty())
+                    continue;
+
+                m_client_port_offset =
+                    std::int32_t(it->second.front()->get_address().port) - std::int32_t(node.get_address().port);
+                break;
+            }
+        }
+
+        if (!m_client_port_offset) {
+            m_logger->log_warning("Can not discover nodes: none of the connected nodes is in the topology");
+            return;
+        }
+
+        std::unordered_set<std::string> names;
+        for (const auto &node : nodes) {
+            names.insert(node.get_name());
+            if (connections->by_node.count(node.get_name()) || m_discovered.count(node.get_name()))
+                continue;
+
+            auto port = std::int32_t(node.get_address().port) + *m_client_port_offset;
+            if (port <= 0 || port > std::numeric_limits<std::uint16_t>::max())
+                continue;
+
+            network::tcp_range addr(node.get_address().host, std::uint16_t(port));
+            added.insert(added.end(), per_node, addr);
+            m_discovered.emplace(node.get_name(), discovered_node{std::move(addr)});
+        }
+
+        for (auto it = m_discovered.begin(); it != m_discovered.end();) {
+            if (names.count(it->first)) {
+                ++it;
+                continue;
+            }
+
+            removed.push_back(std::move(it->second.address));
+            it = m_discovered.erase(it);
+        }
+    }
+
+    auto pool = m_pool;
+    if (!pool)
+        return;
+
+    if (!removed.empty()) {
+        if (m_logger->is_debug_enabled())
+            m_logger->log_debug(std::to_string(removed.size()) + " discovered nodes left the topology");
+
+        pool->remove_addresses(std::move(removed));
+    }
+
+    if (!added.empty()) {
+        if (m_logger->is_debug_enabled())
+            m_logger->log_debug("Discovered " + std::to_string(added.size() / per_node) + " not connected nodes");
+
+        pool->add_addresses(std::move(added));
+    }
+}
+
+bool cluster_connection::verify_discovered_address(const end_point &addr, const std::string *node_name) {
+    network::tcp_range dropped;
+    {
+        std::lock_guard<std::mutex> lock(m_discovery_mutex);
+
+        auto it = std::find_if(m_discovered.begin(), m_discovered.end(), [&addr](const auto &entry) {
+            return entry.second.address.host == addr.host && entry.second.address.port == addr.port;
+        });
+
+        if (it == m_discovered.end() || it->second.verified)
+            return false;
+
+        if (node_name && *node_name == it->first) {
+            it->second.verified = true;
+            return false;
+        }
+
+        m_logger->log_warning("Node " + it->first + " is not available at the discovered address " + addr.to_string()
+            + (node_name ? ", found node " + *node_name + " instead" : std::string()));
+
+        dropped = std::move(it->second.address);
+        m_discovered.erase(it);
+    }
+
+    auto pool = m_pool;
+    if (pool)
+        pool->remove_addresses({std::move(dropped)});
+
+    return true;
+}
+
 void cluster_connection::on_observable_timestamp_changed(std::int64_t timestamp) {
     auto expected = m_observable_timestamp.load();
     while (expected < timestamp) {
@@ -197,10 +676,46 @@ void cluster_connection::on_observable_timestamp_changed(std::int64_t timestamp)
     }
 }
 
+void cluster_connection::on_partition_assignment_changed(std::int64_t timestamp) {
+    auto expected = m_partition_assignment_timestamp.load();
+    while (expected < timestamp) {
+        auto success = m_partition_assignment_timestamp.compare_exchange_weak(expected, timestamp);
+        if (success)
+            return;
+        expected = m_partition_assignment_timestamp.load();
+    }
+}
+
 void cluster_connection::remove_client(uint64_t id) {
-    [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+    update_connections([id](connections_snapshot &connections) {
+        auto it = connections.by_id.find(id);
+        if (it == connections.by_id.end())
+            return false;
+
+        auto &node_name = it->second->get_protocol_context().get_node_name();
+        auto node_it = connections.by_node.find(node_name);
+        if (node_it != connections.by_node.end()) {
+            auto &node_channels = node_it->second;
+            node_channels.erase(std::remove_if(node_channels.begin(), node_channels.end(),
+                                    [id](const auto &channel) { return channel->id() == id; }),
+                node_channels.end());
+
+            if (node_channels.empty())
+                connections.by_node.erase(node_it);
+        }
+
+        connections.by_id.erase(it);
+
+        auto &channels = connections.channels;
+        auto channel_it =
+            std::find_if(channels.begin(), channels.end(), [id](const auto &channel) { return channel->id() == id; });
+        if (channel_it != channels.end()) {
+            std::swap(*channel_it, channels.back());
+            channels.pop_back();
+        }
 
-    m_connections.erase(id);
+        return true;
+    });
 }
 
 void cluster_connection::initial_connect_result(ignite_result<void> &&res) {
@@ -224,22 +739,66 @@ void cluster_connection::initial_connect_result(const protocol::protocol_context
     m_on_initial_connect = {};
 }
 
-std::shared_ptr<node_connection> cluster_connection::get_random_channel() {
-    [[maybe_unused]] std::unique_lock<std::recursive_mutex> lock(m_connections_mutex);
+std::shared_ptr<node_connection> cluster_connection::get_channel(std::optional<std::uint64_t> excluded) {
+    auto connections = get_connections();
 
-    if (m_connections.empty())
+    // Only a retry skips a connection, so the snapshot is not copied for the other requests.
+    std::vector<std::shared_ptr<node_connection>> others;
+    if (excluded)
+        others = without_channel(connections->channels, *excluded);
+
+    const auto &channels = excluded ? others : connections->channels;
+    if (channels.empty())
         return {};
 
-    if (m_connections.size() == 1)
-        return m_connections.begin()->second;
+    if (channels.size() == 1)
+        return channels.front();
+
+    switch (m_configuration.get_balancing_policy()) {
+        case balancing_policy::ROUND_ROBIN:
+            return channels[m_next_channel_idx.fetch_add(1, std::memory_order_relaxed) % channels.size()];
+
+        case balancing_policy::LEAST_OUTSTANDING:
+            return channels[find_least_outstanding_channel(
+                channels, m_next_channel_idx.fetch_add(1, std::memory_order_relaxed))];
+
+        case balancing_policy::LATENCY_WEIGHTED:
+            return channels[find_latency_weighted_channel(
+                channels, m_next_channel_idx.fetch_add(1, std::memory_order_relaxed))];
+
+        case balancing_policy::RANDOM:
+        default:
+            break;
+    }
+
+    thread_local std::mt19937 generator(std::random_device{}());
 
-    std::uniform_int_distribution<size_t> distrib(0, m_connections.size() - 1);
-    auto idx = ptrdiff_t(distrib(m_generator));
-    return std::next(m_connections.begin(), idx)->second;
+    std::uniform_int_distribution<size_t> distrib(0, channels.size() - 1);
+    return channels[distrib(generator)];
+}
+
+std::shared_ptr<node_connection> cluster_connection::get_node_channel(const std::string &node_name) {
+    auto connections = get_connections();
+
+    auto it = connections->by_node.find(node_name);
+    if (it == connections->by_node.end())
+        return {};
+
+    auto &node_channels = it->second;
+    if (node_channels.size() == 1)
+        return node_channels.front();
+
+    return node_channels[find_least_outstanding_channel(
+        node_channels, m_next_channel_idx.fetch_add(1, std::memory_order_relaxed))];
+}
+
+std::uint32_t cluster_connection::get_connections_per_node() const {
+    return std::max(m_configuration.get_connections_per_node(), std::uint32_t(1));
 }
 
 void cluster_connection::perform_request_handler(protocol::client_operation op, transaction_impl *tx,
-    const std::function<void(protocol::writer &)> &wr, const std::shared_ptr<response_handler> &handler) {
+    const std::function<void(protocol::writer &)> &wr, const std::shared_ptr<response_handler> &handler,
+    const std::optional<std::string> &preferred_node) {
     if (tx) {
         auto channel = tx->get_connection();
         if (!channel)
@@ -247,26 +806,75 @@ void cluster_connection::perform_request_handler(protocol::client_operation op,
 
         auto res = channel->perform_request(op, wr, handler);
         if (!res)
-            throw ignite_error("Connection associated with the transaction is closed");
+            throw ignite_error(error::code::CONNECTION, "Connection associated with the transaction is closed");
+
+        return;
+    }
 
+    // Requests which are never retried are written right into the message buffer.
+    if (!m_configuration.get_retry_policy().may_retry(client_operation_type(op))) {
+        send_request(op, wr, handler, preferred_node, std::nullopt);
         return;
     }
 
+    // Encode the request once, so it can be re-sent after the data it is made of is gone.
+    std::vector<std::byte> payload;
+    {
+        protocol::buffer_adapter buffer(payload);
+        protocol::writer writer(buffer);
+        wr(writer);
+    }
+
+    auto timeout = handler->get_timeout().value_or(m_configuration.get_operation_timeout());
+    auto retrying =
+        std::make_shared<retry_handler>(weak_from_this(), op, std::move(payload), handler, preferred_node, timeout);
+    retrying->send(*this);
+}
+
+std::uint64_t cluster_connection::send_request(protocol::client_operation op,
+    const std::function<void(protocol::writer &)> &wr, const std::shared_ptr<response_handler> &handler,
+    const std::optional<std::string> &preferred_node, std::optional<std::uint64_t> excluded) {
+    if (preferred_node) {
+        auto channel = get_node_channel(*preferred_node);
+        if (channel && channel->perform_request(op, wr, handler))
+            return channel->id();
+    }
+
     while (true) {
-        auto channel = get_random_channel();
+        auto channel = get_channel(excluded);
         if (!channel)
-            throw ignite_error("No nodes connected");
+            throw ignite_error(error::code::CONNECTION, "No nodes connected");
 
         auto res = channel->perform_request(op, wr, handler);
         if (res)
-            return;
+            return channel->id();
+    }
+}
+
+void cluster_connection::schedule_retry(std::shared_ptr<retry_handler> handler, std::chrono::milliseconds backoff) {
+    if (backoff.count() <= 0) {
+        handler->resend(*this);
+        return;
     }
+
+    std::lock_guard<std::mutex> lock(m_retries_mutex);
+    m_retries.add(std::chrono::steady_clock::now() + backoff, std::move(handler));
+}
+
+void cluster_connection::schedule(std::chrono::milliseconds delay, std::function<void()> func) {
+    std::lock_guard<std::mutex> lock(m_timers_mutex);
+    m_timers.add(std::chrono::steady_clock::now() + delay, std::move(func));
+}
+
+bool cluster_connection::is_handling_io_event() {
+    return handling_io_event;
 }
 
 void cluster_connection::perform_request_raw(protocol::client_operation op, transaction_impl *tx,
-    const std::function<void(protocol::writer &)> &wr, ignite_callback<bytes_view> callback) {
+    const std::function<void(protocol::writer &)> &wr, ignite_callback<bytes_view> callback,
+    const std::optional<std::string> &preferred_node) {
     auto handler = std::make_shared<response_handler_raw>(std::move(callback));
-    perform_request_handler(op, tx, wr, std::move(handler));
+    perform_request_handler(op, tx, wr, std::move(handler), preferred_node);
 }
 
 } // namespace ignite::detail
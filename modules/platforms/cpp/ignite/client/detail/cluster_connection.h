@@ -22,8 +22,10 @@
 #include "ignite/client/detail/response_handler.h"
 #include "ignite/client/detail/transaction/transaction_impl.h"
 #include "ignite/client/ignite_client_configuration.h"
+#include "ignite/client/network/cluster_node.h"
 #include "ignite/protocol/protocol_context.h"
 
+#include "ignite/common/detail/timer_wheel.h"
 #include "ignite/common/ignite_result.h"
 #include "ignite/network/async_client_pool.h"
 #include "ignite/protocol/client_operation.h"
@@ -31,6 +33,7 @@
 #include "ignite/protocol/writer.h"
 
 #include <array>
+#include <limits>
 #include <functional>
 #include <future>
 #include <memory>
@@ -38,6 +41,7 @@
 #include <random>
 #include <vector>
 #include <optional>
+#include <string>
 #include <unordered_map>
 
 namespace ignite::protocol {
@@ -101,9 +105,12 @@ public:
      * @param tx Transaction.
      * @param wr Request writer function.
      * @param handler Request handler.
+     * @param preferred_node Name of the node that should preferably be used to perform the request. Ignored if
+     *  the transaction is set or the node is not connected.
      */
     void perform_request_handler(protocol::client_operation op, transaction_impl *tx,
-        const std::function<void(protocol::writer &)> &wr, const std::shared_ptr<response_handler> &handler);
+        const std::function<void(protocol::writer &)> &wr, const std::shared_ptr<response_handler> &handler,
+        const std::optional<std::string> &preferred_node = std::nullopt);
 
     /**
      * Perform request raw.
@@ -113,9 +120,11 @@ public:
      * @param tx Transaction.
      * @param wr Request writer function.
      * @param callback Callback to call on result.
+     * @param preferred_node Name of the node that should preferably be used to perform the request.
      */
     void perform_request_raw(protocol::client_operation op, transaction_impl *tx,
-        const std::function<void(protocol::writer &)> &wr, ignite_callback<bytes_view> callback);
+        const std::function<void(protocol::writer &)> &wr, ignite_callback<bytes_view> callback,
+        const std::optional<std::string> &preferred_node = std::nullopt);
 
     /**
      * Perform request raw.
@@ -143,13 +152,14 @@ public:
      * @param wr Request writer function.
      * @param rd response reader function.
      * @param callback Callback to call on result.
+     * @param preferred_node Name of the node that should preferably be used to perform the request.
      */
     template<typename T>
     void perform_request(protocol::client_operation op, transaction_impl *tx,
         const std::function<void(protocol::writer &)> &wr, std::function<T(protocol::reader &)> rd,
-        ignite_callback<T> callback) {
+        ignite_callback<T> callback, const std::optional<std::string> &preferred_node = std::nullopt) {
         auto handler = std::make_shared<response_handler_reader<T>>(std::move(rd), std::move(callback));
-        perform_request_handler(op, tx, wr, std::move(handler));
+        perform_request_handler(op, tx, wr, std::move(handler), preferred_node);
     }
 
     /**
@@ -237,12 +247,14 @@ public:
      * @param tx Transaction.
      * @param wr Request writer function.
      * @param callback Callback to call on result.
+     * @param preferred_node Name of the node that should preferably be used to perform the request.
      */
     template<typename T>
     void perform_request_wr(protocol::client_operation op, transaction_impl *tx,
-        const std::function<void(protocol::writer &)> &wr, ignite_callback<T> callback) {
+        const std::function<void(protocol::writer &)> &wr, ignite_callback<T> callback,
+        const std::optional<std::string> &preferred_node = std::nullopt) {
         perform_request<T>(
-            op, tx, wr, [](protocol::reader &) {}, std::move(callback));
+            op, tx, wr, [](protocol::reader &) {}, std::move(callback), preferred_node);
     }
 
     /**
@@ -252,13 +264,126 @@ public:
      */
     std::int64_t get_observable_timestamp() const { return m_observable_timestamp.load(); }
 
+    /**
+     * Get the timestamp of the latest known partition assignment.
+     *
+     * @return Partition assignment timestamp.
+     */
+    std::int64_t get_partition_assignment_timestamp() const { return m_partition_assignment_timestamp.load(); }
+
+    /**
+     * Schedule a function to be called by an IO thread on a timer tick after the delay.
+     *
+     * The function must not block. Functions which are not called yet are discarded when the connection is stopped.
+     *
+     * @param delay Delay.
+     * @param func Function.
+     */
+    void schedule(std::chrono::milliseconds delay, std::function<void()> func);
+
+    /**
+     * Check whether the current thread is handling an IO event, e.g. is calling a callback of an operation.
+     * Blocking the thread in this case can prevent the completion of the operations it waits for.
+     *
+     * @return @c true if the current thread is handling an IO event.
+     */
+    [[nodiscard]] static bool is_handling_io_event();
+
 private:
     /**
-     * Get random node connection.
+     * Immutable snapshot of the connections.
+     *
+     * Is replaced as a whole on connect and disconnect. The request and response paths only lock to take a reference
+     * to the current snapshot and do not hold the lock while looking up connections in it.
+     */
+    struct connections_snapshot {
+        /** Node connections by connection ID. */
+        std::unordered_map<uint64_t, std::shared_ptr<node_connection>> by_id;
+
+        /** Node connections by node name. */
+        std::unordered_map<std::string, std::vector<std::shared_ptr<node_connection>>> by_node;
+
+        /** Node connections to balance requests between. Contains the same connections as @c by_id. */
+        std::vector<std::shared_ptr<node_connection>> channels;
+    };
+
+    /**
+     * Get node connection according to the configured balancing policy.
+     *
+     * @param excluded ID of the connection to skip if there are others.
+     * @return Node connection or nullptr if there are no active connections.
+     */
+    std::shared_ptr<node_connection> get_channel(std::optional<std::uint64_t> excluded);
+
+    /**
+     * Get connection to the specified node. If there are several, the one with the least number of requests
+     * awaiting a response is chosen.
      *
-     * @return Random node connection or nullptr if there are no active connections.
+     * @param node_name Node name.
+     * @return Node connection or nullptr if there is no active connection to the node.
      */
-    std::shared_ptr<node_connection> get_random_channel();
+    std::shared_ptr<node_connection> get_node_channel(const std::string &node_name);
+
+    /**
+     * Get the number of connections to establish to every node.
+     *
+     * @return Number of connections per node. At least one.
+     */
+    [[nodiscard]] std::uint32_t get_connections_per_node() const;
+
+    /**
+     * Send request over the connection to the preferred node or over a connection chosen by the balancing policy.
+     *
+     * @param op Operation code.
+     * @param wr Request writer function.
+     * @param handler Request handler.
+     * @param preferred_node Name of the node that should preferably be used to perform the request.
+     * @param excluded ID of the connection to skip if there are others.
+     * @return ID of the connection the request was sent over.
+     * @throw ignite_error if there are no connections.
+     */
+    std::uint64_t send_request(protocol::client_operation op, const std::function<void(protocol::writer &)> &wr,
+        const std::shared_ptr<response_handler> &handler, const std::optional<std::string> &preferred_node,
+        std::optional<std::uint64_t> excluded);
+
+    /**
+     * Request the cluster nodes and add the addresses of the nodes which are not connected to the connection pool.
+     */
+    void refresh_topology();
+
+    /**
+     * Handle cluster nodes received on topology refresh.
+     *
+     * Nodes report their addresses for the communication with each other, while clients connect to a different
+     * port. The client connector port of a node which is not connected is derived from its address, assuming all
+     * nodes use the same offset between the ports as the connected ones. The addresses of the nodes which left the
+     * topology are removed from the connection pool.
+     *
+     * @param nodes Cluster nodes.
+     */
+    void on_topology_received(const std::vector<cluster_node> &nodes);
+
+    /**
+     * Check the connection to an address of a discovered node. The address is kept only if the handshake with it
+     * succeeds and the node name matches. Otherwise, it is removed from the connection pool and is tried again on
+     * the next topology refresh.
+     *
+     * @param addr Remote address of the connection.
+     * @param node_name Name of the node reported by the handshake. Null if the connection failed before.
+     * @return @c true if the address was removed, so the connection should be closed.
+     */
+    bool verify_discovered_address(const end_point &addr, const std::string *node_name);
+
+    /** Response handler re-sending failed requests according to the retry policy. */
+    class retry_handler;
+
+    /**
+     * Schedule re-sending of a failed request.
+     *
+     * @param handler Handler of the request.
+     * @param backoff Delay before re-sending.
+     */
+    void schedule_retry(std::shared_ptr<retry_handler> handler, std::chrono::milliseconds backoff);
 
     /**
      * Constructor.
@@ -306,6 +431,11 @@ private:
      */
     void on_message_sent(uint64_t id) override;
 
+    /**
+     * Callback that called periodically by the IO thread.
+     */
+    void on_timer_tick() override;
+
     /**
      * Handle observable timestamp.
      *
@@ -313,6 +443,13 @@ private:
      */
     void on_observable_timestamp_changed(std::int64_t timestamp) override;
 
+    /**
+     * Handle partition assignment change.
+     *
+     * @param timestamp Timestamp of the new partition assignment.
+     */
+    void on_partition_assignment_changed(std::int64_t timestamp) override;
+
     /**
      * Remove client.
      *
@@ -342,6 +479,25 @@ private:
      */
     [[nodiscard]] std::shared_ptr<node_connection> find_client(uint64_t id);
 
+    /**
+     * Get the current connections snapshot.
+     *
+     * @return Connections snapshot.
+     */
+    [[nodiscard]] std::shared_ptr<const connections_snapshot> get_connections() const {
+        std::lock_guard<std::mutex> lock(m_connections_ref_mutex);
+        return m_connections;
+    }
+
+    /**
+     * Modify connections. Publishes a modified copy of the current snapshot.
+     *
+     * @param func Function modifying the snapshot copy. Returns @c false if nothing was changed, so there is no need
+     *  to publish the copy.
+     */
+    template<typename F>
+    void update_connections(F func);
+
     /** Configuration. */
     const ignite_client_configuration m_configuration;
 
@@ -360,17 +516,61 @@ private:
     /** Logger. */
     std::shared_ptr<ignite_logger> m_logger;
 
-    /** Node connections. */
-    std::unordered_map<uint64_t, std::shared_ptr<node_connection>> m_connections;
+    /** Connections snapshot. Protected by m_connections_ref_mutex. */
+    std::shared_ptr<const connections_snapshot> m_connections{std::make_shared<connections_snapshot>()};
 
-    /** Connections mutex. */
-    std::recursive_mutex m_connections_mutex;
+    /** Protects the reference to the connections snapshot. Is only held to copy or replace the reference. */
+    mutable std::mutex m_connections_ref_mutex;
 
-    /** Generator. */
-    std::mt19937 m_generator;
+    /** Serializes modifications of the connections snapshot. */
+    std::mutex m_connections_mutex;
+
+    /** Index of the next connection to use. */
+    std::atomic_size_t m_next_channel_idx{0};
 
     /** Observable timestamp. */
     std::atomic_int64_t m_observable_timestamp{0};
+
+    /** Partition assignment timestamp. */
+    std::atomic_int64_t m_partition_assignment_timestamp{0};
+
+    /** Time of the next topology refresh, in nanoseconds of the steady clock. */
+    std::atomic_int64_t m_next_topology_refresh{std::numeric_limits<std::int64_t>::max()};
+
+    /** Whether a topology refresh is in progress. */
+    std::atomic_bool m_topology_refresh_in_progress{false};
+
+    /**
+     * Node discovered by a topology refresh.
+     */
+    struct discovered_node {
+        /** Derived client connector address. */
+        network::tcp_range address;
+
+        /** Whether the handshake with the node at the address succeeded. */
+        bool verified{false};
+    };
+
+    /** Discovered nodes by names. Protected by m_discovery_mutex. */
+    std::unordered_map<std::string, discovered_node> m_discovered;
+
+    /** Client connector port minus node port, learned from the connected nodes. Protected by m_discovery_mutex. */
+    std::optional<std::int32_t> m_client_port_offset;
+
+    /** Discovery mutex. */
+    std::mutex m_discovery_mutex;
+
+    /** Requests waiting to be re-sent. */
+    timer_wheel<std::shared_ptr<retry_handler>> m_retries;
+
+    /** Retries mutex. */
+    std::mutex m_retries_mutex;
+
+    /** Scheduled functions. */
+    timer_wheel<std::function<void()>> m_timers;
+
+    /** Scheduled functions mutex. */
+    std::mutex m_timers_mutex;
 };
 
 } // namespace ignite::detail
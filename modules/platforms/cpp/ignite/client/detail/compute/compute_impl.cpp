@@ -65,9 +65,7 @@ compute_job_type from_type_id(ignite_type type_id) {
 void write_object_as_binary_tuple(protocol::writer &writer, const primitive &arg) {
     binary_tuple_builder args_builder{3};
 
-    args_builder.start();
-    protocol::claim_primitive_with_type(args_builder, arg);
-    args_builder.layout();
+    args_builder.start_single_pass();
     protocol::append_primitive_with_type(args_builder, arg);
 
     auto args_data = args_builder.build();
@@ -199,13 +197,12 @@ public:
      * @param err Error to set.
      */
     [[nodiscard]] ignite_result<void> set_error(ignite_error err) override {
-        auto res = result_of_operation<void>([&]() {
-            if (!m_execution) {
-                m_callback({std::move(err)});
-            } else {
-                m_execution->set_error(err);
-            }
-        });
+        ignite_result<void> res{};
+        if (!m_execution) {
+            res = invoke_callback({std::move(err)});
+        } else {
+            res = result_of_operation<void>([&]() { m_execution->set_error(err); });
+        }
 
         m_handling_complete = true;
         return res;
@@ -226,9 +223,10 @@ public:
             return m_read_result;
         }
 
+        // The final state is set first, so it is available to the result callback running on the executor.
         auto handle_res = result_of_operation<void>([&]() {
-            m_execution->set_result(m_execution_result);
             m_execution->set_final_state(m_final_state);
+            m_execution->set_result(m_execution_result);
         });
 
         return handle_res;
@@ -252,11 +250,12 @@ public:
 
                 auto id = reader.read_uuid();
                 auto node = read_cluster_node(reader);
-                m_execution = std::make_shared<job_execution_impl>(id, std::move(node), std::move(m_compute));
+                m_execution =
+                    std::make_shared<job_execution_impl>(id, std::move(node), std::move(m_compute), m_executor);
                 return job_execution{m_execution};
             });
 
-            auto handle_res = result_of_operation<void>([&]() { this->m_callback(std::move(read_res)); });
+            auto handle_res = this->invoke_callback(std::move(read_res));
             if (handle_res.has_error() || !m_result_received) {
                 return handle_res;
             }
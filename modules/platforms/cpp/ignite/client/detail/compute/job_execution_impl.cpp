@@ -56,7 +56,7 @@ void job_execution_impl::set_result(std::optional<primitive> result) {
     guard.unlock();
 
     if (callback) {
-        (*callback)({std::move(obj)});
+        invoke_result_callback(std::move(callback), {std::move(obj)});
     }
 }
 
@@ -89,7 +89,25 @@ void job_execution_impl::set_error(ignite_error error) {
     guard.unlock();
 
     if (callback) {
-        (*callback)({std::move(error)});
+        invoke_result_callback(std::move(callback), {std::move(error)});
+    }
+}
+
+void job_execution_impl::invoke_result_callback(
+    std::shared_ptr<ignite_callback<std::optional<binary_object>>> callback,
+    ignite_result<std::optional<binary_object>> res) {
+    if (!m_executor) {
+        (*callback)(std::move(res));
+        return;
+    }
+
+    auto shared_res = std::make_shared<ignite_result<std::optional<binary_object>>>(std::move(res));
+    try {
+        m_executor->execute([callback, shared_res]() {
+            (void) result_of_operation<void>([&]() { (*callback)(std::move(*shared_res)); });
+        });
+    } catch (...) {
+        (*callback)(std::move(*shared_res));
     }
 }
 
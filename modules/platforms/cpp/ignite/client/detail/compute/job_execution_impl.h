@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "ignite/client/callback_executor.h"
 #include "ignite/client/compute/job_execution.h"
 #include "ignite/client/compute/job_state.h"
 #include "ignite/client/detail/cluster_connection.h"
@@ -42,11 +43,14 @@ public:
      * @param id Job ID.
      * @param node Cluster node.
      * @param compute Compute.
+     * @param executor Executor to invoke the result callback on. The callback is invoked on the IO thread if null.
      */
-    explicit job_execution_impl(uuid id, cluster_node node, std::shared_ptr<compute_impl> &&compute)
+    explicit job_execution_impl(uuid id, cluster_node node, std::shared_ptr<compute_impl> &&compute,
+        std::shared_ptr<callback_executor> executor)
         : m_id(id)
         , m_node(std::move(node))
-        , m_compute(compute) {}
+        , m_compute(compute)
+        , m_executor(std::move(executor)) {}
 
     /**
      * Gets the job ID.
@@ -118,6 +122,15 @@ public:
     void change_priority_async(std::int32_t priority, ignite_callback<job_execution::operation_result> callback);
 
 private:
+    /**
+     * Invoke the result callback on the executor, or in place if there is no executor or it rejects the task.
+     *
+     * @param callback Callback.
+     * @param res Result.
+     */
+    void invoke_result_callback(std::shared_ptr<ignite_callback<std::optional<binary_object>>> callback,
+        ignite_result<std::optional<binary_object>> res);
+
     /** Job ID. */
     const uuid m_id;
 
@@ -127,6 +140,9 @@ private:
     /** Compute. */
     std::shared_ptr<compute_impl> m_compute;
 
+    /** Executor to invoke the result callback on. */
+    std::shared_ptr<callback_executor> m_executor;
+
     /** Mutex. Should be held to change any data. */
     std::mutex m_mutex;
 
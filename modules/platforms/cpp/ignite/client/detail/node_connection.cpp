@@ -20,22 +20,37 @@
 #include <ignite/protocol/messages.h>
 #include <ignite/protocol/utils.h>
 
+#include <algorithm>
+
 namespace ignite::detail {
 
-node_connection::node_connection(std::uint64_t id, std::shared_ptr<network::async_client_pool> pool,
+namespace {
+
+/** Number of slots in the timeout wheel. Covers about 50 seconds with the default tick interval. */
+constexpr std::size_t TIMEOUT_WHEEL_SLOTS = 512;
+
+/** Number of the timed out requests remembered to recognize their late responses. */
+constexpr std::size_t EXPIRED_REQUESTS_LIMIT = 1024;
+
+} // namespace
+
+node_connection::node_connection(std::uint64_t id, end_point address, std::shared_ptr<network::async_client_pool> pool,
     std::weak_ptr<connection_event_handler> event_handler, std::shared_ptr<ignite_logger> logger,
     const ignite_client_configuration &cfg)
     : m_id(id)
+    , m_address(std::move(address))
     , m_pool(std::move(pool))
     , m_event_handler(std::move(event_handler))
+    , m_timeouts(network::async_handler::TIMER_TICK_INTERVAL, TIMEOUT_WHEEL_SLOTS)
     , m_logger(std::move(logger))
     , m_configuration(cfg) {
 }
 
 node_connection::~node_connection() {
-    for (auto &handler : m_request_handlers) {
+    for (auto &request : m_request_handlers) {
         auto handling_res = result_of_operation<void>([&]() {
-            auto res = handler.second->set_error(ignite_error("Connection closed before response was received"));
+            auto res = request.second.handler->set_error(
+                ignite_error(error::code::CONNECTION, "Connection closed before response was received"));
             if (res.has_error())
                 m_logger->log_error(
                     "Uncaught user callback exception while handling operation error: " + res.error().what_str());
@@ -62,13 +77,15 @@ bool node_connection::handshake() {
 }
 
 void node_connection::process_message(bytes_view msg) {
+    m_last_received.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+
     protocol::reader reader(msg);
 
     auto req_id = reader.read_int64();
     auto flags = reader.read_int32();
     if (test_flag(flags, protocol::response_flag::PARTITION_ASSIGNMENT_CHANGED)) {
         auto assignment_ts = reader.read_int64();
-        UNUSED_VALUE assignment_ts;
+        on_partition_assignment_changed(assignment_ts);
     }
 
     auto observable_timestamp = reader.read_int64();
@@ -83,28 +100,54 @@ void node_connection::process_message(bytes_view msg) {
     auto pos = reader.position();
     bytes_view data{msg.data() + pos, msg.size() - pos};
 
+    std::shared_ptr<response_handler> handler;
     { // Locking scope
-        std::lock_guard<std::recursive_mutex> lock(m_request_handlers_mutex);
+        std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
+
+        auto it = m_request_handlers.find(req_id);
+        if (it == m_request_handlers.end()) {
+            // Responses of the timed out requests may still come, it is expected.
+            auto expired = std::find(m_expired_requests.begin(), m_expired_requests.end(), req_id);
+            if (expired != m_expired_requests.end()) {
+                m_expired_requests.erase(expired);
+                m_logger->log_debug("Response for timed out request with id=" + std::to_string(req_id));
+            } else {
+                m_logger->log_error("Missing handler for request with id=" + std::to_string(req_id));
+            }
 
-        auto handler = find_handler_unsafe(req_id);
-        if (!handler) {
-            m_logger->log_error("Missing handler for request with id=" + std::to_string(req_id));
             return;
         }
 
-        ignite_result<void> result{};
-        if (err) {
-            result = handler->set_error(std::move(*err));
-        } else {
-            result = handler->handle(shared_from_this(), data, flags);
+        // Requests receiving multiple responses are only limited until the first one.
+        auto &request = it->second;
+        if (request.sent_at != std::chrono::steady_clock::time_point{}) {
+            update_average_latency_unsafe(std::chrono::steady_clock::now() - request.sent_at);
+            request.sent_at = {};
         }
+        cancel_timeout_unsafe(req_id, request);
 
-        if (result.has_error()) {
-            m_logger->log_error("Uncaught user callback exception: " + result.error().what_str());
-        }
+        handler = request.handler;
+    }
+
+    // Responses for the same request are handled sequentially by the IO thread owning the connection.
+    ignite_result<void> result{};
+    if (err) {
+        result = handler->set_error(std::move(*err));
+    } else {
+        result = handler->handle(shared_from_this(), data, flags);
+    }
 
-        if (handler->is_handling_complete()) {
-            m_request_handlers.erase(req_id);
+    if (result.has_error()) {
+        m_logger->log_error("Uncaught user callback exception: " + result.error().what_str());
+    }
+
+    if (handler->is_handling_complete()) {
+        std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
+
+        auto it = m_request_handlers.find(req_id);
+        if (it != m_request_handlers.end() && it->second.handler == handler) {
+            m_request_handlers.erase(it);
+            m_outstanding_requests.store(m_request_handlers.size(), std::memory_order_relaxed);
         }
     }
 }
@@ -116,6 +159,13 @@ void node_connection::on_observable_timestamp_changed(int64_t observable_timesta
     }
 }
 
+void node_connection::on_partition_assignment_changed(int64_t timestamp) const {
+    auto event_handler = m_event_handler.lock();
+    if (event_handler) {
+        event_handler->on_partition_assignment_changed(timestamp);
+    }
+}
+
 ignite_result<void> node_connection::process_handshake_rsp(bytes_view msg) {
     m_logger->log_debug("Got handshake response");
 
@@ -136,30 +186,133 @@ ignite_result<void> node_connection::process_handshake_rsp(bytes_view msg) {
     on_observable_timestamp_changed(response.observable_timestamp);
 
     m_protocol_context = response.context;
-    m_handshake_complete = true;
+
+    auto heartbeat_interval = m_configuration.get_heartbeat_interval();
+    if (heartbeat_interval.count() > 0 && response.idle_timeout.count() > 0) {
+        // Leave enough time for the heartbeat to reach the server before it closes the connection.
+        heartbeat_interval = std::min(heartbeat_interval, response.idle_timeout / 3);
+    }
+    m_heartbeat_interval_ms.store(heartbeat_interval.count(), std::memory_order_relaxed);
+
+    m_last_received.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    m_handshake_complete.store(true, std::memory_order_release);
 
     return {};
 }
 
 std::shared_ptr<response_handler> node_connection::get_and_remove_handler(std::int64_t req_id) {
-    std::lock_guard<std::recursive_mutex> lock(m_request_handlers_mutex);
+    std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
 
     auto it = m_request_handlers.find(req_id);
     if (it == m_request_handlers.end())
         return {};
 
-    auto res = std::move(it->second);
+    cancel_timeout_unsafe(req_id, it->second);
+
+    auto res = std::move(it->second.handler);
     m_request_handlers.erase(it);
+    m_outstanding_requests.store(m_request_handlers.size(), std::memory_order_relaxed);
 
     return res;
 }
 
-std::shared_ptr<response_handler> node_connection::find_handler_unsafe(std::int64_t req_id) {
-    auto it = m_request_handlers.find(req_id);
-    if (it == m_request_handlers.end())
-        return {};
+void node_connection::on_timer_tick(std::chrono::steady_clock::time_point now) {
+    handle_timeouts(now);
+
+    if (m_handshake_complete.load(std::memory_order_acquire))
+        send_heartbeat_if_idle(now);
+}
+
+void node_connection::handle_timeouts(std::chrono::steady_clock::time_point now) {
+    std::vector<std::pair<std::int64_t, std::shared_ptr<response_handler>>> expired;
+    {
+        std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
+
+        m_timeouts.expire(now, [this, &expired](std::int64_t req_id) {
+            // The timeouts of the requests are cancelled once they are responded or removed.
+            auto it = m_request_handlers.find(req_id);
+            if (it == m_request_handlers.end())
+                return;
+
+            expired.emplace_back(req_id, std::move(it->second.handler));
+            m_request_handlers.erase(it);
+
+            m_expired_requests.push_back(req_id);
+            if (m_expired_requests.size() > EXPIRED_REQUESTS_LIMIT)
+                m_expired_requests.pop_front();
+        });
+
+        if (expired.empty())
+            return;
+
+        m_outstanding_requests.store(m_request_handlers.size(), std::memory_order_relaxed);
+    }
+
+    for (auto &[req_id, handler] : expired) {
+        m_logger->log_warning("Request timed out: req_id=" + std::to_string(req_id));
+
+        auto res = handler->set_error(ignite_error(error::code::CONNECTION, "Operation timed out"));
+        if (res.has_error())
+            m_logger->log_error("Uncaught user callback exception: " + res.error().what_str());
+    }
+}
+
+void node_connection::send_heartbeat_if_idle(std::chrono::steady_clock::time_point now) {
+    std::chrono::milliseconds heartbeat_interval{m_heartbeat_interval_ms.load(std::memory_order_relaxed)};
+    if (heartbeat_interval.count() <= 0)
+        return;
+
+    std::chrono::steady_clock::time_point last_received{
+        std::chrono::steady_clock::duration(m_last_received.load(std::memory_order_relaxed))};
+
+    if (now - last_received < heartbeat_interval)
+        return;
+
+    // Only one heartbeat is sent at a time.
+    if (m_heartbeat_in_flight.exchange(true, std::memory_order_relaxed))
+        return;
+
+    std::weak_ptr<node_connection> self_weak = shared_from_this();
+    auto handler = std::make_shared<response_handler_reader<void>>([](protocol::reader &) {},
+        [self_weak](ignite_result<void> &&res) {
+            if (auto self = self_weak.lock())
+                self->on_heartbeat_result(std::move(res));
+        });
+    handler->set_timeout(m_configuration.get_heartbeat_timeout());
+
+    if (!perform_request(protocol::client_operation::HEARTBEAT, [](protocol::writer &) {}, std::move(handler)))
+        m_heartbeat_in_flight.store(false, std::memory_order_relaxed);
+}
+
+void node_connection::on_heartbeat_result(ignite_result<void> &&res) {
+    m_heartbeat_in_flight.store(false, std::memory_order_relaxed);
+
+    if (!res.has_error())
+        return;
+
+    // Timeouts are reported as connection errors. Closing the connection which has already failed is harmless.
+    auto err = res.error();
+    if (err.get_status_code() != error::code::CONNECTION)
+        return;
+
+    m_logger->log_warning("Heartbeat failed, closing the connection. Connection ID: " + std::to_string(m_id)
+        + ", error: " + err.what_str());
+
+    m_pool->close(m_id, ignite_error(error::code::CONNECTION, "Heartbeat failed: " + err.what_str()));
+}
+
+void node_connection::update_average_latency_unsafe(std::chrono::nanoseconds latency) {
+    // Weight of a new sample, same as the one used for the smoothed RTT in TCP.
+    constexpr std::int64_t SAMPLE_WEIGHT_DIVISOR = 8;
+
+    auto sample = latency.count();
+    auto average = m_average_latency.load(std::memory_order_relaxed);
+    if (average == 0)
+        average = sample;
+    else
+        average += (sample - average) / SAMPLE_WEIGHT_DIVISOR;
 
-    return it->second;
+    m_average_latency.store(average, std::memory_order_relaxed);
 }
 
 } // namespace ignite::detail
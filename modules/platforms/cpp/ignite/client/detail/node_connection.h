@@ -23,12 +23,18 @@
 #include <ignite/client/ignite_client_configuration.h>
 #include <ignite/protocol/client_operation.h>
 
+#include <ignite/common/detail/buffer_pool.h>
+#include <ignite/common/detail/timer_wheel.h>
 #include <ignite/common/detail/utils.h>
+#include <ignite/common/end_point.h>
 #include <ignite/network/async_client_pool.h>
 #include <ignite/protocol/reader.h>
 #include <ignite/protocol/writer.h>
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <future>
 #include <memory>
 #include <mutex>
@@ -63,17 +69,18 @@ public:
      * Makes new instance.
      *
      * @param id Connection ID.
+     * @param address Remote address.
      * @param pool Connection pool.
      * @param event_handler Event handler.
      * @param logger Logger.
      * @param cfg Configuration.
      * @return New instance.
      */
-    static std::shared_ptr<node_connection> make_new(std::uint64_t id, std::shared_ptr<network::async_client_pool> pool,
-        std::weak_ptr<connection_event_handler> event_handler, std::shared_ptr<ignite_logger> logger,
-        const ignite_client_configuration &cfg) {
-        return std::shared_ptr<node_connection>(
-            new node_connection(id, std::move(pool), std::move(event_handler), std::move(logger), cfg));
+    static std::shared_ptr<node_connection> make_new(std::uint64_t id, end_point address,
+        std::shared_ptr<network::async_client_pool> pool, std::weak_ptr<connection_event_handler> event_handler,
+        std::shared_ptr<ignite_logger> logger, const ignite_client_configuration &cfg) {
+        return std::shared_ptr<node_connection>(new node_connection(
+            id, std::move(address), std::move(pool), std::move(event_handler), std::move(logger), cfg));
     }
 
     /**
@@ -83,12 +90,19 @@ public:
      */
     [[nodiscard]] std::uint64_t id() const { return m_id; }
 
+    /**
+     * Get remote address.
+     *
+     * @return Remote address.
+     */
+    [[nodiscard]] const end_point &get_address() const { return m_address; }
+
     /**
      * Check whether handshake complete.
      *
      * @return @c true if the handshake complete.
      */
-    [[nodiscard]] bool is_handshake_complete() const { return m_handshake_complete; }
+    [[nodiscard]] bool is_handshake_complete() const { return m_handshake_complete.load(std::memory_order_acquire); }
 
     /**
      * Send request.
@@ -102,7 +116,7 @@ public:
     bool perform_request(protocol::client_operation op, const std::function<void(protocol::writer &)> &wr,
         std::shared_ptr<response_handler> handler) {
         auto req_id = generate_request_id();
-        std::vector<std::byte> message;
+        auto message = buffer_pool::get_default().lease(get_request_size_estimate(op));
         {
             protocol::buffer_adapter buffer(message);
             buffer.reserve_length_header();
@@ -115,9 +129,20 @@ public:
             buffer.write_length_header();
         }
 
+        update_request_size_estimate(op, message.size());
+
+        if (auto &executor = m_configuration.get_callback_executor())
+            handler->set_executor(executor);
+
         {
-            std::lock_guard<std::recursive_mutex> lock(m_request_handlers_mutex);
-            m_request_handlers[req_id] = std::move(handler);
+            auto timeout = handler->get_timeout().value_or(m_configuration.get_operation_timeout());
+            auto now = std::chrono::steady_clock::now();
+
+            std::lock_guard<std::mutex> lock(m_request_handlers_mutex);
+            std::int64_t timeout_tick = timeout.count() > 0 ? m_timeouts.add(now + timeout, req_id) : -1;
+
+            m_request_handlers[req_id] = {std::move(handler), now, timeout_tick};
+            m_outstanding_requests.store(m_request_handlers.size(), std::memory_order_relaxed);
         }
 
         if (m_logger->is_debug_enabled()) {
@@ -187,6 +212,13 @@ public:
      */
     ignite_result<void> process_handshake_rsp(bytes_view msg);
 
+    /**
+     * Handle timer tick: fail the timed out requests and send a heartbeat if the connection is idle.
+     *
+     * @param now Current time.
+     */
+    void on_timer_tick(std::chrono::steady_clock::time_point now);
+
     /**
      * Gets protocol context.
      *
@@ -194,17 +226,50 @@ public:
      */
     const protocol::protocol_context &get_protocol_context() const { return m_protocol_context; }
 
+    /**
+     * Get the number of requests awaiting a response.
+     *
+     * @return Number of outstanding requests.
+     */
+    [[nodiscard]] std::size_t get_outstanding_requests() const {
+        return m_outstanding_requests.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the exponentially weighted moving average of the response latency.
+     *
+     * @return Average latency. Zero if no response was received yet.
+     */
+    [[nodiscard]] std::chrono::nanoseconds get_average_latency() const {
+        return std::chrono::nanoseconds(m_average_latency.load(std::memory_order_relaxed));
+    }
+
 private:
+    /**
+     * Request awaiting a response.
+     */
+    struct pending_request {
+        /** Response handler. */
+        std::shared_ptr<response_handler> handler;
+
+        /** Time the request was sent. Reset once the first response is received. */
+        std::chrono::steady_clock::time_point sent_at;
+
+        /** Tick of the request timeout in the timeout wheel. Negative if there is no timeout. */
+        std::int64_t timeout_tick{-1};
+    };
+
     /**
      * Constructor.
      *
      * @param id Connection ID.
+     * @param address Remote address.
      * @param pool Connection pool.
      * @param event_handler Event handler.
      * @param logger Logger.
      * @param cfg Configuration.
      */
-    node_connection(std::uint64_t id, std::shared_ptr<network::async_client_pool> pool,
+    node_connection(std::uint64_t id, end_point address, std::shared_ptr<network::async_client_pool> pool,
         std::weak_ptr<connection_event_handler> event_handler, std::shared_ptr<ignite_logger> logger,
         const ignite_client_configuration &cfg);
 
@@ -224,13 +289,47 @@ private:
     std::shared_ptr<response_handler> get_and_remove_handler(std::int64_t req_id);
 
     /**
-     * Find handler by ID.
+     * Fail the requests which did not receive a response within their timeouts.
+     *
+     * @param now Current time.
+     */
+    void handle_timeouts(std::chrono::steady_clock::time_point now);
+
+    /**
+     * Cancel the timeout of the request. Should be called with m_request_handlers_mutex held.
+     *
+     * @param req_id Request ID.
+     * @param request Request.
+     */
+    void cancel_timeout_unsafe(std::int64_t req_id, pending_request &request) {
+        if (request.timeout_tick < 0)
+            return;
+
+        m_timeouts.cancel(request.timeout_tick, req_id);
+        request.timeout_tick = -1;
+    }
+
+    /**
+     * Send a heartbeat if nothing was received for the heartbeat interval.
+     *
+     * @param now Current time.
+     */
+    void send_heartbeat_if_idle(std::chrono::steady_clock::time_point now);
+
+    /**
+     * Handle heartbeat result.
+     *
+     * @param res Result.
+     */
+    void on_heartbeat_result(ignite_result<void> &&res);
+
+    /**
+     * Account a response latency sample in the average latency.
      * @warning Warning: m_request_handlers_mutex should be locked.
      *
-     * @param reqId Request ID.
-     * @return Handler.
+     * @param latency Latency of a response.
      */
-    std::shared_ptr<response_handler> find_handler_unsafe(std::int64_t req_id);
+    void update_average_latency_unsafe(std::chrono::nanoseconds latency);
 
     /**
      * Notify event handler about observable timestamp change.
@@ -239,8 +338,48 @@ private:
      */
     void on_observable_timestamp_changed(int64_t observable_timestamp) const;
 
-    /** Handshake complete. */
-    bool m_handshake_complete{false};
+    /**
+     * Notify event handler about partition assignment change.
+     *
+     * @param timestamp Timestamp of the new partition assignment.
+     */
+    void on_partition_assignment_changed(int64_t timestamp) const;
+
+    /**
+     * Get the expected size of the request.
+     *
+     * @param op Operation code.
+     * @return Expected size of the request. Zero if unknown.
+     */
+    [[nodiscard]] std::size_t get_request_size_estimate(protocol::client_operation op) const {
+        auto idx = std::size_t(op);
+        if (idx >= m_request_size_estimates.size())
+            return 0;
+
+        return m_request_size_estimates[idx].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Update the expected size of the requests of the operation.
+     *
+     * The estimate follows the larger requests right away and decays slowly after them, so the leased buffers
+     * rarely have to grow.
+     *
+     * @param op Operation code.
+     * @param size Size of the request.
+     */
+    void update_request_size_estimate(protocol::client_operation op, std::size_t size) {
+        auto idx = std::size_t(op);
+        if (idx >= m_request_size_estimates.size())
+            return;
+
+        auto &estimate = m_request_size_estimates[idx];
+        auto prev = estimate.load(std::memory_order_relaxed);
+        estimate.store(std::max(size, prev - prev / 8), std::memory_order_relaxed);
+    }
+
+    /** Handshake complete. Set by the IO thread, read by the timer thread. */
+    std::atomic_bool m_handshake_complete{false};
 
     /** Protocol context. */
     protocol::protocol_context m_protocol_context;
@@ -248,6 +387,9 @@ private:
     /** Connection ID. */
     std::uint64_t m_id{0};
 
+    /** Remote address. */
+    const end_point m_address;
+
     /** Connection pool. */
     std::shared_ptr<network::async_client_pool> m_pool;
 
@@ -257,11 +399,35 @@ private:
     /** Request ID generator. */
     std::atomic_int64_t m_req_id_gen{0};
 
-    /** Pending request handlers. */
-    std::unordered_map<std::int64_t, std::shared_ptr<response_handler>> m_request_handlers;
+    /** Pending requests. */
+    std::unordered_map<std::int64_t, pending_request> m_request_handlers;
 
     /** Handlers map mutex. */
-    std::recursive_mutex m_request_handlers_mutex;
+    std::mutex m_request_handlers_mutex;
+
+    /** Deadlines of the pending requests by request IDs. Protected by m_request_handlers_mutex. */
+    timer_wheel<std::int64_t> m_timeouts;
+
+    /** IDs of the recently timed out requests, oldest first. Protected by m_request_handlers_mutex. */
+    std::deque<std::int64_t> m_expired_requests;
+
+    /** Number of pending requests. */
+    std::atomic_size_t m_outstanding_requests{0};
+
+    /** Heartbeat interval in milliseconds. Zero if heartbeats are disabled. */
+    std::atomic_int64_t m_heartbeat_interval_ms{0};
+
+    /** Time the last message was received, in nanoseconds of the steady clock. */
+    std::atomic_int64_t m_last_received{0};
+
+    /** Whether a heartbeat is awaiting a response. */
+    std::atomic_bool m_heartbeat_in_flight{false};
+
+    /** Average response latency in nanoseconds. */
+    std::atomic_int64_t m_average_latency{0};
+
+    /** Expected request sizes by operation codes. */
+    std::array<std::atomic_size_t, 64> m_request_size_estimates{};
 
     /** Logger. */
     std::shared_ptr<ignite_logger> m_logger;
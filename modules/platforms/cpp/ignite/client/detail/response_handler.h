@@ -17,16 +17,22 @@
 
 #pragma once
 
+#include "ignite/client/callback_executor.h"
 #include "ignite/client/detail/node_connection.h"
 #include "ignite/common/ignite_error.h"
 #include "ignite/common/ignite_result.h"
 #include "ignite/protocol/messages.h"
 #include "ignite/protocol/reader.h"
 
+#include <chrono>
 #include <functional>
 #include <future>
 #include <memory>
+#include <optional>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ignite::detail {
 
@@ -64,9 +70,36 @@ public:
      */
     [[nodiscard]] bool is_handling_complete() const { return m_handling_complete; }
 
+    /**
+     * Get the timeout overriding the configured operation timeout for the request.
+     *
+     * @return Timeout. Zero means no timeout. Not set if the configured one should be used.
+     */
+    [[nodiscard]] std::optional<std::chrono::milliseconds> get_timeout() const { return m_timeout; }
+
+    /**
+     * Set the timeout overriding the configured operation timeout for the request.
+     *
+     * @param timeout Timeout. Zero means no timeout.
+     */
+    void set_timeout(std::chrono::milliseconds timeout) { m_timeout = timeout; }
+
+    /**
+     * Set the executor to invoke the callback on.
+     *
+     * @param executor Executor. If not set, the callback is invoked on the thread handling the response.
+     */
+    virtual void set_executor(std::shared_ptr<callback_executor> executor) { m_executor = std::move(executor); }
+
 protected:
     /** Handling completion flag. */
     bool m_handling_complete{false};
+
+    /** Timeout overriding the configured operation timeout. */
+    std::optional<std::chrono::milliseconds> m_timeout;
+
+    /** Executor to invoke the callback on. */
+    std::shared_ptr<callback_executor> m_executor;
 };
 
 /**
@@ -91,12 +124,16 @@ public:
      * @param msg Message.
      */
     [[nodiscard]] ignite_result<void> handle(std::shared_ptr<node_connection>, bytes_view msg, std::int32_t) final {
-        auto res = result_of_operation<void>([&]() { return m_callback(bytes_view{msg}); });
-        if (res.has_error()) {
-            m_callback(std::move(res).error());
-        }
         this->m_handling_complete = true;
-        return res;
+
+        // The callback reads the message itself, so the message has to be copied to outlive the receive buffer.
+        if (m_executor) {
+            return dispatch([callback = std::move(m_callback), msg = std::vector<std::byte>(msg)]() mutable {
+                (void) invoke(callback, bytes_view{msg});
+            });
+        }
+
+        return invoke(m_callback, msg);
     }
 
     /**
@@ -105,11 +142,50 @@ public:
      * @param err Error to set.
      */
     [[nodiscard]] ignite_result<void> set_error(ignite_error err) override {
-        auto res = result_of_operation<void>([&]() { m_callback({std::move(err)}); });
         m_handling_complete = true;
+
+        if (m_executor) {
+            return dispatch([callback = std::move(m_callback), err = std::move(err)]() mutable {
+                (void) result_of_operation<void>([&]() { callback({std::move(err)}); });
+            });
+        }
+
+        return result_of_operation<void>([&]() { m_callback({std::move(err)}); });
+    }
+
+private:
+    /**
+     * Invoke the callback with the message, passing it the error if it throws.
+     *
+     * @param callback Callback.
+     * @param msg Message.
+     * @return Result of the invocation.
+     */
+    static ignite_result<void> invoke(ignite_callback<bytes_view> &callback, bytes_view msg) {
+        auto res = result_of_operation<void>([&]() { return callback(bytes_view{msg}); });
+        if (res.has_error()) {
+            callback(std::move(res).error());
+        }
         return res;
     }
 
+    /**
+     * Schedule the task on the executor, or execute it in place if the executor rejects it.
+     *
+     * @param task Task.
+     * @return Result of the scheduling.
+     */
+    template<typename F>
+    ignite_result<void> dispatch(F &&task) {
+        auto shared_task = std::make_shared<std::decay_t<F>>(std::forward<F>(task));
+        try {
+            m_executor->execute([shared_task]() { (*shared_task)(); });
+        } catch (...) {
+            (*shared_task)();
+        }
+        return {};
+    }
+
 private:
     /** Callback. */
     ignite_callback<bytes_view> m_callback;
@@ -138,14 +214,53 @@ public:
      * @param err Error to set.
      */
     [[nodiscard]] ignite_result<void> set_error(ignite_error err) override {
-        auto res = result_of_operation<void>([&]() { m_callback({std::move(err)}); });
+        auto res = invoke_callback({std::move(err)});
         m_handling_complete = true;
         return res;
     }
 
 protected:
+    /**
+     * Invoke the callback with the result, on the executor if it is set. If the callback throws on a successful
+     * result, it is invoked again with the error.
+     *
+     * @param res Result.
+     * @return Result of the invocation. Always successful if the callback is scheduled on the executor.
+     */
+    ignite_result<void> invoke_callback(ignite_result<T> &&res) {
+        if (!m_executor)
+            return invoke(m_callback, std::move(res));
+
+        auto task = std::make_shared<std::pair<ignite_callback<T>, ignite_result<T>>>(
+            std::move(m_callback), std::move(res));
+        try {
+            m_executor->execute([task]() { (void) invoke(task->first, std::move(task->second)); });
+            return {};
+        } catch (...) {
+            return invoke(task->first, std::move(task->second));
+        }
+    }
+
     /** Callback. */
     ignite_callback<T> m_callback;
+
+private:
+    /**
+     * Invoke the callback with the result in place.
+     *
+     * @param callback Callback.
+     * @param res Result.
+     * @return Result of the invocation.
+     */
+    static ignite_result<void> invoke(ignite_callback<T> &callback, ignite_result<T> &&res) {
+        bool read_error = res.has_error();
+
+        auto handle_res = result_of_operation<void>([&]() { callback(std::move(res)); });
+        if (!read_error && handle_res.has_error()) {
+            handle_res = result_of_operation<void>([&]() { callback(std::move(handle_res.error())); });
+        }
+        return handle_res;
+    }
 };
 
 /**
@@ -177,12 +292,7 @@ public:
     [[nodiscard]] ignite_result<void> handle(
         std::shared_ptr<node_connection> channel, bytes_view msg, std::int32_t) final {
         auto read_res = result_of_operation<T>([&]() { return m_read_func(std::move(channel), msg); });
-        bool read_error = read_res.has_error();
-
-        auto handle_res = result_of_operation<void>([&]() { this->m_callback(std::move(read_res)); });
-        if (!read_error && handle_res.has_error()) {
-            handle_res = result_of_operation<void>([&]() { this->m_callback(std::move(handle_res.error())); });
-        }
+        auto handle_res = this->invoke_callback(std::move(read_res));
 
         this->m_handling_complete = true;
         return handle_res;
@@ -220,12 +330,7 @@ public:
     [[nodiscard]] ignite_result<void> handle(std::shared_ptr<node_connection>, bytes_view msg, std::int32_t) final {
         protocol::reader reader(msg);
         auto read_res = result_of_operation<T>([&]() { return m_read_func(reader); });
-        bool read_error = read_res.has_error();
-
-        auto handle_res = result_of_operation<void>([&]() { this->m_callback(std::move(read_res)); });
-        if (!read_error && handle_res.has_error()) {
-            handle_res = result_of_operation<void>([&]() { this->m_callback(std::move(handle_res.error())); });
-        }
+        auto handle_res = this->invoke_callback(std::move(read_res));
 
         this->m_handling_complete = true;
         return handle_res;
@@ -266,12 +371,7 @@ public:
         std::shared_ptr<node_connection> conn, bytes_view msg, std::int32_t) final {
         protocol::reader reader(msg);
         auto read_res = result_of_operation<T>([&]() { return m_read_func(reader, conn); });
-        bool read_error = read_res.has_error();
-
-        auto handle_res = result_of_operation<void>([&]() { this->m_callback(std::move(read_res)); });
-        if (!read_error && handle_res.has_error()) {
-            handle_res = result_of_operation<void>([&]() { this->m_callback(std::move(handle_res.error())); });
-        }
+        auto handle_res = this->invoke_callback(std::move(read_res));
 
         this->m_handling_complete = true;
         return handle_res;
@@ -43,13 +43,7 @@ void write_statement(protocol::writer &writer, const sql_statement &statement) {
 
     binary_tuple_builder prop_builder{props_num * 4};
 
-    prop_builder.start();
-    for (const auto &property : properties) {
-        prop_builder.claim_varlen(property.first);
-        protocol::claim_primitive_with_type(prop_builder, property.second);
-    }
-
-    prop_builder.layout();
+    prop_builder.start_single_pass();
     for (const auto &property : properties) {
         prop_builder.append_varlen(property.first);
         protocol::append_primitive_with_type(prop_builder, property.second);
@@ -74,12 +68,7 @@ void write_args(protocol::writer &writer, const std::vector<primitive> &args) {
 
     binary_tuple_builder args_builder{args_num * 3};
 
-    args_builder.start();
-    for (const auto &arg : args) {
-        protocol::claim_primitive_with_type(args_builder, arg);
-    }
-
-    args_builder.layout();
+    args_builder.start_single_pass();
     for (const auto &arg : args) {
         protocol::append_primitive_with_type(args_builder, arg);
     }
@@ -108,8 +97,11 @@ void sql_impl::execute_async(transaction *tx, const sql_statement &statement, st
         return result_set{std::make_shared<result_set_impl>(std::move(channel), msg)};
     };
 
-    m_connection->perform_request_bytes<result_set>(
-        protocol::client_operation::SQL_EXEC, tx0.get(), writer_func, std::move(reader_func), std::move(callback));
+    auto handler = std::make_shared<response_handler_bytes<result_set>>(std::move(reader_func), std::move(callback));
+    if (statement.timeout().count() > 0)
+        handler->set_timeout(statement.timeout());
+
+    m_connection->perform_request_handler(protocol::client_operation::SQL_EXEC, tx0.get(), writer_func, handler);
 }
 
 void sql_impl::execute_script_async(
@@ -121,8 +113,11 @@ void sql_impl::execute_script_async(
         writer.write(m_connection->get_observable_timestamp());
     };
 
-    m_connection->perform_request_wr<void>(
-        protocol::client_operation::SQL_EXEC_SCRIPT, nullptr, writer_func, std::move(callback));
+    auto handler = std::make_shared<response_handler_reader<void>>([](protocol::reader &) {}, std::move(callback));
+    if (statement.timeout().count() > 0)
+        handler->set_timeout(statement.timeout());
+
+    m_connection->perform_request_handler(protocol::client_operation::SQL_EXEC_SCRIPT, nullptr, writer_func, handler);
 }
 
 } // namespace ignite::detail
@@ -0,0 +1,518 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "data_streamer_impl.h"
+
+#include "ignite/client/detail/utils.h"
+
+#include "ignite/common/detail/bits.h"
+#include "ignite/protocol/bitset_span.h"
+#include "ignite/protocol/writer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+
+namespace ignite::detail {
+
+data_streamer_impl::data_streamer_impl(std::shared_ptr<table_impl> table, data_streamer_options options,
+    std::shared_ptr<schema> sch, std::shared_ptr<const table_impl::partition_assignment> assignment)
+    : m_table(std::move(table))
+    , m_options(options)
+    , m_hash_schema(sch)
+    , m_partitions(assignment->partitions)
+    , m_schema(std::move(sch))
+    , m_assignment(std::move(assignment))
+    , m_buffers(m_partitions) {
+}
+
+data_streamer_impl::~data_streamer_impl() {
+    stop_timer();
+}
+
+void data_streamer_impl::create_async(std::shared_ptr<table_impl> table, data_streamer_options options,
+    ignite_callback<std::shared_ptr<data_streamer_impl>> callback) {
+    if (options.get_page_size() <= 0)
+        throw ignite_error("Page size must be positive: " + std::to_string(options.get_page_size()));
+
+    if (options.get_per_node_parallel_operations() <= 0)
+        throw ignite_error("Number of parallel operations per node must be positive: "
+            + std::to_string(options.get_per_node_parallel_operations()));
+
+    if (options.get_auto_flush_interval().count() <= 0)
+        throw ignite_error("Auto flush interval must be positive: "
+            + std::to_string(options.get_auto_flush_interval().count()) + "ms");
+
+    if (options.get_retry_limit() < 0)
+        throw ignite_error("Retry limit can not be negative: " + std::to_string(options.get_retry_limit()));
+
+    auto table0 = table;
+    table0->with_latest_schema_async<std::shared_ptr<data_streamer_impl>>(
+        std::move(callback), [table = std::move(table), options](const schema &sch, auto callback) mutable {
+            auto sch0 = table->get_schema(sch.version);
+            auto table0 = table;
+            table0->get_partition_assignment_async(
+                [table = std::move(table), options, sch0 = std::move(sch0), callback = std::move(callback)](
+                    auto &&res) mutable {
+                    if (res.has_error()) {
+                        callback(ignite_error{res.error()});
+                        return;
+                    }
+
+                    auto streamer =
+                        std::make_shared<data_streamer_impl>(std::move(table), options, std::move(sch0), res.value());
+
+                    streamer->start_timer();
+                    callback(std::move(streamer));
+                });
+        });
+}
+
+void data_streamer_impl::add(ignite_tuple record, data_streamer_operation_type op) {
+    auto partition = get_partition(record);
+    auto page_size = std::size_t(m_options.get_page_size());
+
+    std::vector<std::shared_ptr<batch>> to_send;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto &buffer = m_buffers[partition];
+        auto has_room = [&] { return m_error || m_closed || buffer.rows.size() < page_size; };
+        if (!has_room() && cluster_connection::is_handling_io_event()) {
+            // The batches making room in the buffer are completed by the IO threads, one of which would be blocked.
+            throw ignite_error("Data streamer buffer of the partition is full, and waiting for room in a callback of "
+                               "an asynchronous operation can block the completion of the batches. Flush the "
+                               "streamer asynchronously and continue adding records in the flush callback");
+        }
+
+        m_room_cond.wait(lock, has_room);
+
+        check_can_add_unsafe();
+
+        buffer.rows.push_back({std::move(record), op == data_streamer_operation_type::REMOVE});
+        ++m_buffered;
+
+        collect_unsafe(partition, m_flushing, to_send);
+    }
+
+    send(to_send);
+}
+
+bool data_streamer_impl::try_add(ignite_tuple &record, data_streamer_operation_type op) {
+    auto partition = get_partition(record);
+    auto page_size = std::size_t(m_options.get_page_size());
+
+    std::vector<std::shared_ptr<batch>> to_send;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        check_can_add_unsafe();
+
+        auto &buffer = m_buffers[partition];
+        if (buffer.rows.size() >= page_size)
+            return false;
+
+        buffer.rows.push_back({std::move(record), op == data_streamer_operation_type::REMOVE});
+        ++m_buffered;
+
+        collect_unsafe(partition, m_flushing, to_send);
+    }
+
+    send(to_send);
+
+    return true;
+}
+
+void data_streamer_impl::flush_async(ignite_callback<void> callback) {
+    std::vector<std::shared_ptr<batch>> to_send;
+    std::vector<ignite_callback<void>> flushed;
+    std::optional<ignite_error> err;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_error) {
+            err = m_error;
+        } else {
+            m_flushing = true;
+            m_flush_callbacks.push_back(std::move(callback));
+
+            collect_all_unsafe(true, to_send);
+            check_flushed_unsafe(flushed);
+        }
+    }
+
+    if (err) {
+        callback(std::move(*err));
+        return;
+    }
+
+    send(to_send);
+
+    for (auto &flush_callback : flushed)
+        flush_callback({});
+}
+
+void data_streamer_impl::close_async(ignite_callback<void> callback) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+
+    m_room_cond.notify_all();
+
+    flush_async([self = shared_from_this(), callback = std::move(callback)](ignite_result<void> &&res) {
+        self->stop_timer();
+        callback(std::move(res));
+    });
+}
+
+void data_streamer_impl::stream_async(
+    std::function<std::optional<ignite_tuple>()> source, ignite_callback<void> callback) {
+    m_source = std::move(source);
+    m_stream_callback = std::move(callback);
+
+    request_pump();
+}
+
+std::int32_t data_streamer_impl::get_partition(const ignite_tuple &record) const {
+    return std::abs(calc_colocation_hash(*m_hash_schema, record) % m_partitions);
+}
+
+void data_streamer_impl::check_can_add_unsafe() const {
+    if (m_error)
+        throw ignite_error{*m_error};
+
+    if (m_closed)
+        throw ignite_error("Data streamer is closed");
+}
+
+void data_streamer_impl::collect_unsafe(
+    std::int32_t partition, bool incomplete, std::vector<std::shared_ptr<batch>> &out) {
+    auto page_size = std::size_t(m_options.get_page_size());
+
+    auto &buffer = m_buffers[partition];
+    if (buffer.in_flight || buffer.retry_pending || buffer.rows.empty())
+        return;
+
+    if (!incomplete && buffer.rows.size() < page_size)
+        return;
+
+    std::optional<std::string> node;
+    if (!m_assignment->nodes.empty())
+        node = m_assignment->nodes[partition];
+
+    auto &node_in_flight = m_node_in_flight[node.value_or(std::string())];
+    if (node_in_flight >= m_options.get_per_node_parallel_operations())
+        return;
+
+    auto b = std::make_shared<batch>();
+    b->partition = partition;
+    b->node = std::move(node);
+
+    if (buffer.rows.size() <= page_size) {
+        b->rows.swap(buffer.rows);
+    } else {
+        auto end = buffer.rows.begin() + std::ptrdiff_t(page_size);
+        b->rows.assign(std::make_move_iterator(buffer.rows.begin()), std::make_move_iterator(end));
+        buffer.rows.erase(buffer.rows.begin(), end);
+    }
+
+    buffer.in_flight = true;
+    ++node_in_flight;
+    ++m_in_flight;
+    m_buffered -= b->rows.size();
+
+    out.push_back(std::move(b));
+}
+
+void data_streamer_impl::collect_all_unsafe(bool incomplete, std::vector<std::shared_ptr<batch>> &out) {
+    auto actual = m_table->get_partition_assignment();
+    if (actual && actual->partitions == m_partitions && !actual->nodes.empty())
+        m_assignment = std::move(actual);
+
+    for (std::int32_t partition = 0; partition < m_partitions; ++partition)
+        collect_unsafe(partition, incomplete, out);
+}
+
+void data_streamer_impl::check_flushed_unsafe(std::vector<ignite_callback<void>> &out) {
+    if (!m_flushing || m_buffered != 0 || m_in_flight != 0)
+        return;
+
+    m_flushing = false;
+    std::move(m_flush_callbacks.begin(), m_flush_callbacks.end(), std::back_inserter(out));
+    m_flush_callbacks.clear();
+}
+
+void data_streamer_impl::fail_unsafe(ignite_error err, std::vector<ignite_callback<void>> &out) {
+    m_error = std::move(err);
+
+    for (auto &buffer : m_buffers)
+        buffer.rows.clear();
+
+    m_buffered = 0;
+    m_flushing = false;
+
+    std::move(m_flush_callbacks.begin(), m_flush_callbacks.end(), std::back_inserter(out));
+    m_flush_callbacks.clear();
+}
+
+void data_streamer_impl::send(const std::vector<std::shared_ptr<batch>> &batches) {
+    for (const auto &b : batches)
+        send_batch(b);
+}
+
+void data_streamer_impl::send_batch(std::shared_ptr<batch> b) {
+    std::shared_ptr<schema> sch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        sch = m_schema;
+    }
+
+    auto writer_func = [id = m_table->get_id(), &b, &sch](protocol::writer &writer) {
+        const auto count = b->rows.size();
+
+        writer.write(id);
+        writer.write(b->partition);
+
+        bool any_deleted = std::any_of(b->rows.begin(), b->rows.end(), [](const row &r) { return r.deleted; });
+        if (any_deleted) {
+            std::vector<std::byte> deleted_bytes(bytes_for_bits(count));
+            protocol::bitset_span deleted(deleted_bytes.data(), deleted_bytes.size());
+            for (std::size_t i = 0; i < count; ++i) {
+                if (b->rows[i].deleted)
+                    deleted.set(i);
+            }
+
+            writer.write_bitset(deleted.data());
+        } else {
+            writer.write_nil();
+        }
+
+        binary_tuple_builder key_builder{std::int32_t(sch->key_columns.size())};
+        binary_tuple_builder row_builder{std::int32_t(sch->columns.size())};
+
+        writer.write(sch->version);
+        writer.write(std::int32_t(count));
+        for (const auto &r : b->rows)
+            write_tuple(writer, *sch, r.tuple, r.deleted, r.deleted ? key_builder : row_builder);
+    };
+
+    auto callback = [self = shared_from_this(), b](ignite_result<void> &&res) {
+        self->on_batch_complete(b, std::move(res));
+    };
+
+    try {
+        m_table->get_connection()->perform_request_wr<void>(
+            protocol::client_operation::STREAMER_BATCH_SEND, nullptr, writer_func, std::move(callback), b->node);
+    } catch (const ignite_error &err) {
+        on_batch_complete(std::move(b), ignite_error{err});
+    }
+}
+
+void data_streamer_impl::on_batch_complete(std::shared_ptr<batch> b, ignite_result<void> &&res) {
+    std::vector<std::shared_ptr<batch>> to_send;
+    std::vector<ignite_callback<void>> flushed;
+    std::vector<ignite_callback<void>> failed;
+    std::optional<std::int32_t> expected_schema;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto &buffer = m_buffers[b->partition];
+        buffer.in_flight = false;
+        --m_node_in_flight[b->node.value_or(std::string())];
+        --m_in_flight;
+
+        if (res.has_error() && !m_error) {
+            auto err = res.error();
+            expected_schema = err.get_extra<std::int32_t>(protocol::error_extensions::EXPECTED_SCHEMA_VERSION);
+
+            // Other errors, e.g. constraint violations, are not going to be fixed by a retry.
+            bool retriable = expected_schema || err.get_status_code() == error::code::CONNECTION;
+            if (retriable && buffer.attempts < m_options.get_retry_limit()) {
+                ++buffer.attempts;
+                buffer.retry_pending = true;
+
+                m_buffered += b->rows.size();
+                buffer.rows.insert(buffer.rows.begin(), std::make_move_iterator(b->rows.begin()),
+                    std::make_move_iterator(b->rows.end()));
+            } else {
+                expected_schema.reset();
+                fail_unsafe(std::move(err), failed);
+            }
+        } else if (!res.has_error()) {
+            buffer.attempts = 0;
+        }
+
+        if (!m_error) {
+            collect_all_unsafe(m_flushing, to_send);
+            check_flushed_unsafe(flushed);
+        }
+    }
+
+    m_room_cond.notify_all();
+
+    send(to_send);
+
+    if (expected_schema) {
+        auto table = m_table;
+        table->with_schema_async<std::shared_ptr<schema>>(
+            *expected_schema,
+            [self = shared_from_this(), partition = b->partition](
+                auto &&res) { self->on_schema_loaded(partition, std::move(res)); },
+            [table](const schema &sch, auto callback) { callback(table->get_schema(sch.version)); });
+    }
+
+    for (auto &flush_callback : flushed)
+        flush_callback({});
+
+    for (auto &flush_callback : failed)
+        flush_callback(ignite_error{*m_error});
+
+    request_pump();
+}
+
+void data_streamer_impl::on_schema_loaded(std::int32_t partition, ignite_result<std::shared_ptr<schema>> &&res) {
+    std::vector<std::shared_ptr<batch>> to_send;
+    std::vector<ignite_callback<void>> failed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_error)
+            return;
+
+        if (res.has_error()) {
+            fail_unsafe(std::move(res).error(), failed);
+        } else {
+            if (res.value())
+                m_schema = res.value();
+
+            m_buffers[partition].retry_pending = false;
+            collect_all_unsafe(m_flushing, to_send);
+        }
+    }
+
+    send(to_send);
+
+    for (auto &flush_callback : failed)
+        flush_callback(ignite_error{*m_error});
+
+    if (!failed.empty())
+        m_room_cond.notify_all();
+
+    request_pump();
+}
+
+void data_streamer_impl::start_timer() {
+    m_table->get_connection()->schedule(m_options.get_auto_flush_interval(), [weak = weak_from_this()]() {
+        auto self = weak.lock();
+        if (!self || self->m_timer_stopped.load())
+            return;
+
+        self->on_timer();
+        self->start_timer();
+    });
+}
+
+void data_streamer_impl::stop_timer() {
+    m_timer_stopped.store(true);
+}
+
+void data_streamer_impl::on_timer() {
+    std::vector<std::shared_ptr<batch>> to_send;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_error)
+            return;
+
+        for (auto &buffer : m_buffers)
+            buffer.retry_pending = false;
+
+        collect_all_unsafe(true, to_send);
+    }
+
+    send(to_send);
+}
+
+void data_streamer_impl::request_pump() {
+    if (m_pump_requests.fetch_add(1) > 0)
+        return;
+
+    do {
+        pump();
+    } while (m_pump_requests.fetch_sub(1) > 1);
+}
+
+void data_streamer_impl::pump() {
+    // The source is only set for the streamers created to stream from it, before any record is added.
+    if (!m_source)
+        return;
+
+    while (true) {
+        if (!m_source_record) {
+            std::optional<ignite_tuple> record;
+            auto res = result_of_operation<void>([&]() { record = m_source(); });
+            if (res.has_error()) {
+                m_source = nullptr;
+                complete_stream(std::move(res));
+                return;
+            }
+
+            if (!record) {
+                m_source = nullptr;
+                close_async([self = shared_from_this()](
+                                ignite_result<void> &&res) { self->complete_stream(std::move(res)); });
+                return;
+            }
+
+            m_source_record = std::move(record);
+        }
+
+        try {
+            if (!try_add(*m_source_record, data_streamer_operation_type::PUT))
+                return;
+        } catch (const ignite_error &err) {
+            m_source = nullptr;
+            complete_stream(ignite_error{err});
+            return;
+        }
+
+        m_source_record.reset();
+    }
+}
+
+void data_streamer_impl::complete_stream(ignite_result<void> &&res) {
+    if (m_stream_complete.exchange(true))
+        return;
+
+    if (res.has_error()) {
+        std::vector<ignite_callback<void>> failed;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_error)
+                fail_unsafe(ignite_error{res.error()}, failed);
+        }
+
+        m_room_cond.notify_all();
+        stop_timer();
+
+        for (auto &flush_callback : failed)
+            flush_callback(ignite_error{res.error()});
+    }
+
+    m_stream_callback(std::move(res));
+}
+
+} // namespace ignite::detail
@@ -0,0 +1,353 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/detail/table/schema.h"
+#include "ignite/client/detail/table/table_impl.h"
+#include "ignite/client/table/data_streamer.h"
+#include "ignite/client/table/data_streamer_options.h"
+#include "ignite/client/table/ignite_tuple.h"
+
+#include "ignite/common/ignite_error.h"
+#include "ignite/common/ignite_result.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Data streamer implementation.
+ *
+ * Rows are buffered per partition. Only one batch per partition is in flight at any moment, which preserves the order
+ * of operations within a partition, and the number of batches in flight to a single node is limited by the options.
+ * Batches failed with a connection error are re-sent on the next auto flush, batches failed because of an outdated
+ * schema are re-sent as soon as the expected schema is loaded.
+ */
+class data_streamer_impl : public std::enable_shared_from_this<data_streamer_impl> {
+public:
+    // Deleted
+    data_streamer_impl() = delete;
+    data_streamer_impl(data_streamer_impl &&) = delete;
+    data_streamer_impl(const data_streamer_impl &) = delete;
+    data_streamer_impl &operator=(data_streamer_impl &&) = delete;
+    data_streamer_impl &operator=(const data_streamer_impl &) = delete;
+
+    /**
+     * Constructor.
+     *
+     * @param table Table.
+     * @param options Options.
+     * @param sch Latest schema of the table.
+     * @param assignment Partition assignment of the table.
+     */
+    data_streamer_impl(std::shared_ptr<table_impl> table, data_streamer_options options, std::shared_ptr<schema> sch,
+        std::shared_ptr<const table_impl::partition_assignment> assignment);
+
+    /**
+     * Destructor.
+     */
+    ~data_streamer_impl();
+
+    /**
+     * Create a new data streamer asynchronously.
+     *
+     * @param table Table.
+     * @param options Options.
+     * @param callback Callback to call with the new streamer.
+     */
+    static void create_async(std::shared_ptr<table_impl> table, data_streamer_options options,
+        ignite_callback<std::shared_ptr<data_streamer_impl>> callback);
+
+    /**
+     * Add a record. Blocks while the buffer of the record's partition is full.
+     *
+     * Throws instead of blocking if the buffer is full and the current thread is handling an IO event, as the room
+     * in the buffer is made by the IO threads.
+     *
+     * @param record Record.
+     * @param op Operation type.
+     */
+    void add(ignite_tuple record, data_streamer_operation_type op);
+
+    /**
+     * Send all the buffered records.
+     *
+     * @param callback Callback to call when there are no buffered or in-flight records left.
+     */
+    void flush_async(ignite_callback<void> callback);
+
+    /**
+     * Send all the buffered records and close the streamer.
+     *
+     * @param callback Callback to call when all the records are sent.
+     */
+    void close_async(ignite_callback<void> callback);
+
+    /**
+     * Stream all the records from the source and close the streamer.
+     *
+     * The source is pulled only while there is a room in the buffers, so it is called both from the calling thread
+     * and from the threads that complete the batches. It must not block. Must be called right after the streamer is
+     * created, before any record is added.
+     *
+     * @param source Source of records. Returns @c std::nullopt when there are no more records.
+     * @param callback Callback to call when all the records are sent.
+     */
+    void stream_async(std::function<std::optional<ignite_tuple>()> source, ignite_callback<void> callback);
+
+private:
+    /**
+     * Buffered row.
+     */
+    struct row {
+        /** Tuple. */
+        ignite_tuple tuple;
+
+        /** Whether the row is to be removed. */
+        bool deleted{false};
+    };
+
+    /**
+     * Batch of rows sent to a single partition.
+     */
+    struct batch {
+        /** Partition. */
+        std::int32_t partition{0};
+
+        /** Node the batch is sent to. Not set if the node is unknown. */
+        std::optional<std::string> node;
+
+        /** Rows. */
+        std::vector<row> rows;
+    };
+
+    /**
+     * Buffer of a single partition.
+     */
+    struct partition_buffer {
+        /** Rows which were not sent yet, oldest first. */
+        std::vector<row> rows;
+
+        /** Whether there is a batch in flight for the partition. */
+        bool in_flight{false};
+
+        /** Whether the partition is waiting for the next auto flush or a schema to re-send a failed batch. */
+        bool retry_pending{false};
+
+        /** Number of consecutive failed attempts to send a batch. */
+        std::int32_t attempts{0};
+    };
+
+    /**
+     * Add a record without blocking.
+     *
+     * @param record Record. Moved from only on success.
+     * @param op Operation type.
+     * @return @c true if the record was added and @c false if the buffer of the partition is full.
+     */
+    bool try_add(ignite_tuple &record, data_streamer_operation_type op);
+
+    /**
+     * Get partition of the record.
+     *
+     * @param record Record.
+     * @return Partition.
+     */
+    [[nodiscard]] std::int32_t get_partition(const ignite_tuple &record) const;
+
+    /**
+     * Check that records can be added.
+     * @warning m_mutex should be locked.
+     */
+    void check_can_add_unsafe() const;
+
+    /**
+     * Take the next batch of the partition if it can be sent now.
+     * @warning m_mutex should be locked.
+     *
+     * @param partition Partition.
+     * @param incomplete Whether an incomplete batch should be taken as well.
+     * @param out Batches to send.
+     */
+    void collect_unsafe(std::int32_t partition, bool incomplete, std::vector<std::shared_ptr<batch>> &out);
+
+    /**
+     * Take the batches that can be sent now.
+     * @warning m_mutex should be locked.
+     *
+     * @param incomplete Whether incomplete batches should be taken as well.
+     * @param out Batches to send.
+     */
+    void collect_all_unsafe(bool incomplete, std::vector<std::shared_ptr<batch>> &out);
+
+    /**
+     * Complete the flush if there is nothing left to send.
+     * @warning m_mutex should be locked.
+     *
+     * @param out Flush callbacks to call.
+     */
+    void check_flushed_unsafe(std::vector<ignite_callback<void>> &out);
+
+    /**
+     * Move the streamer to the failed state, discarding all the buffered rows.
+     * @warning m_mutex should be locked.
+     *
+     * @param err Error.
+     * @param out Flush callbacks to call with the error.
+     */
+    void fail_unsafe(ignite_error err, std::vector<ignite_callback<void>> &out);
+
+    /**
+     * Send batches.
+     *
+     * @param batches Batches.
+     */
+    void send(const std::vector<std::shared_ptr<batch>> &batches);
+
+    /**
+     * Send a single batch.
+     *
+     * @param b Batch.
+     */
+    void send_batch(std::shared_ptr<batch> b);
+
+    /**
+     * Handle batch completion.
+     *
+     * @param b Batch.
+     * @param res Result.
+     */
+    void on_batch_complete(std::shared_ptr<batch> b, ignite_result<void> &&res);
+
+    /**
+     * Handle loading of the schema that is expected by the server.
+     *
+     * @param partition Partition waiting for the schema.
+     * @param res Loaded schema.
+     */
+    void on_schema_loaded(std::int32_t partition, ignite_result<std::shared_ptr<schema>> &&res);
+
+    /**
+     * Schedule the next auto flush. Auto flush is driven by the IO thread timer ticks, and the scheduled function
+     * only holds a weak reference to the streamer.
+     */
+    void start_timer();
+
+    /**
+     * Stop auto flush timer.
+     */
+    void stop_timer();
+
+    /**
+     * Handle auto flush timer tick.
+     */
+    void on_timer();
+
+    /**
+     * Request pulling of the records from the source. Only one thread pulls the records at any moment.
+     */
+    void request_pump();
+
+    /**
+     * Pull the records from the source while there is a room in the buffers.
+     */
+    void pump();
+
+    /**
+     * Complete streaming from the source.
+     *
+     * @param res Result.
+     */
+    void complete_stream(ignite_result<void> &&res);
+
+    /** Table. */
+    const std::shared_ptr<table_impl> m_table;
+
+    /** Options. */
+    const data_streamer_options m_options;
+
+    /** Schema used to calculate partitions. Colocation columns do not change between schema versions. */
+    const std::shared_ptr<schema> m_hash_schema;
+
+    /** Number of partitions. */
+    const std::int32_t m_partitions;
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Notified when batches complete and room in buffers may become available. */
+    std::condition_variable m_room_cond;
+
+    /** Schema used to serialize rows. */
+    std::shared_ptr<schema> m_schema;
+
+    /** Partition assignment. */
+    std::shared_ptr<const table_impl::partition_assignment> m_assignment;
+
+    /** Buffers by partitions. */
+    std::vector<partition_buffer> m_buffers;
+
+    /** Number of batches in flight by nodes. Batches to unknown nodes are counted under the empty name. */
+    std::unordered_map<std::string, std::int32_t> m_node_in_flight;
+
+    /** Total number of batches in flight. */
+    std::int32_t m_in_flight{0};
+
+    /** Total number of buffered rows. */
+    std::size_t m_buffered{0};
+
+    /** Error the streamer has failed with. */
+    std::optional<ignite_error> m_error;
+
+    /** Closed flag. */
+    bool m_closed{false};
+
+    /** Whether a flush is in progress. Incomplete batches are sent as soon as possible while it is. */
+    bool m_flushing{false};
+
+    /** Callbacks waiting for the flush completion. */
+    std::vector<ignite_callback<void>> m_flush_callbacks;
+
+    /** Source of records. Only accessed by the pulling thread. */
+    std::function<std::optional<ignite_tuple>()> m_source;
+
+    /** Record pulled from the source which did not fit into the buffer yet. Only accessed by the pulling thread. */
+    std::optional<ignite_tuple> m_source_record;
+
+    /** Callback to call when streaming from the source is complete. */
+    ignite_callback<void> m_stream_callback;
+
+    /** Whether streaming from the source is complete. */
+    std::atomic_bool m_stream_complete{false};
+
+    /** Number of pull requests. */
+    std::atomic_int32_t m_pump_requests{0};
+
+    /** Whether the auto flush timer is stopped. */
+    std::atomic_bool m_timer_stopped{false};
+};
+
+} // namespace ignite::detail
@@ -21,8 +21,6 @@
 #include "ignite/common/ignite_type.h"
 #include "ignite/protocol/reader.h"
 
-#include <msgpack.h>
-
 #include <algorithm>
 #include <array>
 #include <memory>
@@ -83,6 +81,7 @@ struct schema {
     const std::vector<column> columns;
     const std::vector<const column *> key_columns;
     const std::vector<const column *> val_columns;
+    const std::vector<const column *> colocation_columns;
 
     // Default
     schema() = default;
@@ -94,13 +93,15 @@ struct schema {
      * @param columns Columns.
      * @param key_columns Key Columns.
      * @param val_columns Value Columns.
+     * @param colocation_columns Colocation Columns.
      */
     schema(std::int32_t version, std::vector<column> &&columns, std::vector<const column *> &&key_columns,
-        std::vector<const column *> &&val_columns)
+        std::vector<const column *> &&val_columns, std::vector<const column *> &&colocation_columns)
         : version(version)
         , columns(std::move(columns))
         , key_columns(std::move(key_columns))
-        , val_columns(std::move(val_columns)) {}
+        , val_columns(std::move(val_columns))
+        , colocation_columns(std::move(colocation_columns)) {}
 
     /**
      * Get column by index.
@@ -123,9 +124,13 @@ struct schema {
      */
     static std::shared_ptr<schema> create_instance(std::int32_t version, std::vector<column> &&cols) {
         std::int32_t key_columns_cnt = 0;
+        std::int32_t colocation_columns_cnt = 0;
         for (const auto &column : cols) {
             if (column.is_key())
                 ++key_columns_cnt;
+
+            if (column.colocation_index >= 0)
+                ++colocation_columns_cnt;
         }
         std::int32_t val_columns_cnt = std::int32_t(cols.size()) - key_columns_cnt;
 
@@ -134,6 +139,8 @@ struct schema {
         std::vector<const column *> val_columns;
         val_columns.reserve(val_columns_cnt);
 
+        std::vector<const column *> colocation_columns(colocation_columns_cnt, nullptr);
+
         for (const auto &column : cols) {
             if (column.is_key()) {
                 assert(column.key_index >= 0 && std::size_t(column.key_index) < key_columns.size());
@@ -143,9 +150,21 @@ struct schema {
             } else {
                 val_columns.push_back(&column);
             }
+
+            if (column.colocation_index >= 0) {
+                assert(std::size_t(column.colocation_index) < colocation_columns.size());
+                assert(colocation_columns[column.colocation_index] == nullptr);
+
+                colocation_columns[column.colocation_index] = &column;
+            }
         }
 
-        return std::make_shared<schema>(version, std::move(cols), std::move(key_columns), std::move(val_columns));
+        // Key columns are used for colocation by default.
+        if (colocation_columns.empty())
+            colocation_columns = key_columns;
+
+        return std::make_shared<schema>(version, std::move(cols), std::move(key_columns), std::move(val_columns),
+            std::move(colocation_columns));
     }
 
     /**
@@ -28,6 +28,12 @@
 #include "ignite/protocol/writer.h"
 #include "ignite/tuple/binary_tuple_parser.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <type_traits>
+#include <variant>
+
 namespace ignite::detail {
 
 /**
@@ -112,6 +118,240 @@ std::function<void(ignite_result<bytes_view>)> make_schema_handler_function(std:
     };
 }
 
+/**
+ * Function that sends a batch of tuples to the specified node.
+ *
+ * @tparam T Result type.
+ */
+template<typename T>
+using batch_sender_function = std::function<void(
+    std::shared_ptr<std::vector<ignite_tuple>>, const std::optional<std::string> &, ignite_callback<T>)>;
+
+/**
+ * State of the batch operation that was split into several requests.
+ *
+ * @tparam T Result type.
+ */
+template<typename T>
+class batch_operation_state {
+public:
+    /** Result type of a single request. */
+    using part_type = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    /** Function that merges results of all the requests into one. */
+    using merge_function = std::function<part_type(std::vector<part_type> &&, const std::vector<tuple_batch> &)>;
+
+    /**
+     * Constructor.
+     *
+     * @param batches Batches.
+     * @param callback User callback.
+     * @param merge Merge function.
+     */
+    batch_operation_state(std::vector<tuple_batch> &&batches, ignite_callback<T> callback, merge_function merge)
+        : m_batches(std::move(batches))
+        , m_remaining(m_batches.size())
+        , m_parts(m_batches.size())
+        , m_callback(std::move(callback))
+        , m_merge(std::move(merge)) {}
+
+    /**
+     * Get batches.
+     *
+     * @return Batches.
+     */
+    [[nodiscard]] const std::vector<tuple_batch> &get_batches() const { return m_batches; }
+
+    /**
+     * Handle completion of the request for a single batch. Calls user callback when all the requests are complete.
+     *
+     * @param idx Batch index.
+     * @param res Result.
+     */
+    void complete_part(std::size_t idx, ignite_result<T> &&res) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (res.has_error()) {
+                if (!m_error)
+                    m_error = std::move(res).error();
+            } else {
+                if constexpr (!std::is_void_v<T>)
+                    m_parts[idx] = std::move(res).value();
+            }
+
+            if (--m_remaining > 0)
+                return;
+        }
+
+        if (m_error) {
+            m_callback(std::move(*m_error));
+            return;
+        }
+
+        if constexpr (std::is_void_v<T>)
+            m_callback({});
+        else
+            m_callback(m_merge(std::move(m_parts), m_batches));
+    }
+
+private:
+    /** Batches. */
+    const std::vector<tuple_batch> m_batches;
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Number of requests that are not complete yet. */
+    std::size_t m_remaining;
+
+    /** Results of the requests. */
+    std::vector<part_type> m_parts;
+
+    /** First error. */
+    std::optional<ignite_error> m_error;
+
+    /** User callback. */
+    ignite_callback<T> m_callback;
+
+    /** Merge function. */
+    merge_function m_merge;
+};
+
+/**
+ * Perform batch operation, sending every batch in a separate request. Requests are performed in parallel.
+ *
+ * @tparam T Result type.
+ * @param batches Batches.
+ * @param tuples All the tuples of the operation.
+ * @param callback User callback.
+ * @param send Function that sends a batch.
+ * @param merge Function that merges results of the requests. Not used when @c T is void.
+ */
+template<typename T>
+void perform_batch_async(std::vector<tuple_batch> &&batches, const std::shared_ptr<std::vector<ignite_tuple>> &tuples,
+    ignite_callback<T> callback, const batch_sender_function<T> &send,
+    typename batch_operation_state<T>::merge_function merge = {}) {
+    if (batches.size() == 1) {
+        send(tuples, batches.front().node, std::move(callback));
+        return;
+    }
+
+    auto state = std::make_shared<batch_operation_state<T>>(std::move(batches), std::move(callback), std::move(merge));
+    const auto &state_batches = state->get_batches();
+    for (std::size_t i = 0; i < state_batches.size(); ++i) {
+        const auto &batch = state_batches[i];
+
+        auto part = std::make_shared<std::vector<ignite_tuple>>();
+        part->reserve(batch.indices.size());
+        for (auto idx : batch.indices)
+            part->push_back((*tuples)[idx]);
+
+        try {
+            send(part, batch.node, [state, i](ignite_result<T> &&res) { state->complete_part(i, std::move(res)); });
+        } catch (const ignite_error &err) {
+            state->complete_part(i, ignite_result<T>{ignite_error(err)});
+        }
+    }
+}
+
+/**
+ * Merge results of the batches where every result corresponds to a tuple of the batch at the same position.
+ *
+ * @tparam E Element type.
+ * @param parts Results of the batches.
+ * @param batches Batches.
+ * @return Result in the order of the original tuple sequence.
+ */
+template<typename E>
+std::vector<E> merge_by_position(std::vector<std::vector<E>> &&parts, const std::vector<tuple_batch> &batches) {
+    std::size_t total = 0;
+    for (const auto &batch : batches)
+        total += batch.indices.size();
+
+    std::vector<E> res(total);
+    for (std::size_t i = 0; i < batches.size(); ++i) {
+        const auto &indices = batches[i].indices;
+        auto &part = parts[i];
+
+        for (std::size_t j = 0; j < part.size() && j < indices.size(); ++j)
+            res[indices[j]] = std::move(part[j]);
+    }
+
+    return res;
+}
+
+/**
+ * Check whether the key columns of two tuples are equal.
+ *
+ * @param key_columns Names of the key columns.
+ * @param tuple1 Tuple 1.
+ * @param tuple2 Tuple 2.
+ * @return @c true if the key column values are equal.
+ */
+bool keys_equal(const std::vector<std::string> &key_columns, const ignite_tuple &tuple1, const ignite_tuple &tuple2) {
+    for (const auto &name : key_columns) {
+        auto idx1 = tuple1.column_ordinal(name);
+        auto idx2 = tuple2.column_ordinal(name);
+
+        if (idx1 < 0 || idx2 < 0) {
+            if (idx1 != idx2)
+                return false;
+
+            continue;
+        }
+
+        if (tuple1.get(idx1) != tuple2.get(idx2))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Make a function that merges results of the batches where every result is a subsequence of the batch tuples, e.g.
+ * a list of the tuples that were not inserted.
+ *
+ * @param sch Schema.
+ * @param tuples All the tuples of the operation.
+ * @return Merge function. Keeps the order of the original tuple sequence.
+ */
+batch_operation_state<std::vector<ignite_tuple>>::merge_function make_subsequence_merge_function(
+    const schema &sch, std::shared_ptr<std::vector<ignite_tuple>> tuples) {
+    std::vector<std::string> key_columns;
+    key_columns.reserve(sch.key_columns.size());
+    for (const auto *col : sch.key_columns)
+        key_columns.push_back(col->name);
+
+    return [key_columns = std::move(key_columns), tuples = std::move(tuples)](
+               std::vector<std::vector<ignite_tuple>> &&parts, const std::vector<tuple_batch> &batches) {
+        std::vector<std::pair<std::size_t, ignite_tuple>> indexed;
+        for (std::size_t i = 0; i < batches.size(); ++i) {
+            const auto &indices = batches[i].indices;
+
+            // Results of a batch keep the order of its tuples, so a single pass is enough to restore the indices.
+            std::size_t pos = 0;
+            for (auto &res_tuple : parts[i]) {
+                while (pos < indices.size() && !keys_equal(key_columns, res_tuple, (*tuples)[indices[pos]]))
+                    ++pos;
+
+                auto idx = pos < indices.size() ? indices[pos++] : tuples->size();
+                indexed.emplace_back(idx, std::move(res_tuple));
+            }
+        }
+
+        std::stable_sort(
+            indexed.begin(), indexed.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+
+        std::vector<ignite_tuple> res;
+        res.reserve(indexed.size());
+        for (auto &pair : indexed)
+            res.push_back(std::move(pair.second));
+
+        return res;
+    };
+}
+
 void table_impl::load_schema_async(
     std::optional<std::int32_t> version, ignite_callback<std::shared_ptr<schema>> callback) {
     auto writer_func = [&](protocol::writer &writer) {
@@ -145,6 +385,185 @@ void table_impl::load_schema_async(
         protocol::client_operation::SCHEMAS_GET, writer_func, std::move(reader_func), std::move(callback));
 }
 
+std::optional<std::string> table_impl::get_key_node(
+    const partition_assignment &assignment, const schema &sch, const ignite_tuple &key) {
+    if (assignment.nodes.empty())
+        return std::nullopt;
+
+    std::int32_t hash;
+    try {
+        hash = calc_colocation_hash(sch, key);
+    } catch (const ignite_error &) {
+        // Invalid key is going to be reported by the operation itself.
+        return std::nullopt;
+    }
+
+    auto partition = std::abs(hash % std::int32_t(assignment.nodes.size()));
+
+    return assignment.nodes[partition];
+}
+
+std::optional<std::string> table_impl::get_preferred_node(
+    const transaction_impl *tx, const schema &sch, const ignite_tuple &key) {
+    if (tx)
+        return std::nullopt;
+
+    auto assignment = get_partition_assignment();
+    if (!assignment)
+        return std::nullopt;
+
+    return get_key_node(*assignment, sch, key);
+}
+
+std::vector<tuple_batch> table_impl::split_by_node(
+    const transaction_impl *tx, const schema &sch, const std::vector<ignite_tuple> &tuples) {
+    std::shared_ptr<const partition_assignment> assignment;
+    if (!tx && tuples.size() > 1)
+        assignment = get_partition_assignment();
+
+    if (!assignment || assignment->nodes.empty()) {
+        tuple_batch all;
+        all.indices.resize(tuples.size());
+        std::iota(all.indices.begin(), all.indices.end(), std::size_t(0));
+
+        return {std::move(all)};
+    }
+
+    std::vector<tuple_batch> batches;
+    std::unordered_map<std::string, std::size_t> node_batches;
+    std::optional<std::size_t> unknown_node_batch;
+
+    for (std::size_t i = 0; i < tuples.size(); ++i) {
+        auto node = get_key_node(*assignment, sch, tuples[i]);
+
+        std::size_t batch_idx = batches.size();
+        if (node) {
+            auto [it, inserted] = node_batches.emplace(*node, batch_idx);
+            if (!inserted)
+                batch_idx = it->second;
+        } else {
+            if (unknown_node_batch)
+                batch_idx = *unknown_node_batch;
+            else
+                unknown_node_batch = batch_idx;
+        }
+
+        if (batch_idx == batches.size())
+            batches.push_back({std::move(node), {}});
+
+        batches[batch_idx].indices.push_back(i);
+    }
+
+    return batches;
+}
+
+std::shared_ptr<const table_impl::partition_assignment> table_impl::get_partition_assignment() {
+    std::shared_ptr<const partition_assignment> assignment;
+    {
+        std::lock_guard<std::mutex> lock(m_partition_assignment_mutex);
+        assignment = m_partition_assignment;
+    }
+
+    auto timestamp = m_connection->get_partition_assignment_timestamp();
+    if (!assignment || assignment->timestamp < timestamp)
+        load_partition_assignment_async(timestamp);
+
+    return assignment;
+}
+
+void table_impl::get_partition_assignment_async(
+    ignite_callback<std::shared_ptr<const partition_assignment>> callback) {
+    auto timestamp = m_connection->get_partition_assignment_timestamp();
+
+    std::shared_ptr<const partition_assignment> assignment;
+    {
+        std::lock_guard<std::mutex> lock(m_partition_assignment_mutex);
+
+        if (m_partition_assignment && m_partition_assignment->timestamp >= timestamp)
+            assignment = m_partition_assignment;
+        else
+            m_partition_assignment_waiters.push_back(std::move(callback));
+    }
+
+    if (assignment)
+        callback(std::move(assignment));
+    else
+        load_partition_assignment_async(timestamp);
+}
+
+void table_impl::load_partition_assignment_async(std::int64_t timestamp) {
+    if (m_partition_assignment_loading.exchange(true))
+        return;
+
+    auto writer_func = [id = m_id, timestamp](protocol::writer &writer) {
+        writer.write(id);
+        writer.write(timestamp);
+    };
+
+    auto reader_func = [timestamp](protocol::reader &reader) -> std::shared_ptr<const partition_assignment> {
+        auto partitions_cnt = reader.read_int32();
+        if (partitions_cnt <= 0)
+            throw ignite_error("Invalid partition count returned by the server: " + std::to_string(partitions_cnt));
+
+        auto res = std::make_shared<partition_assignment>();
+        res->timestamp = timestamp;
+        res->partitions = partitions_cnt;
+
+        auto assignment_available = reader.read_bool();
+        if (!assignment_available)
+            return res;
+
+        UNUSED_VALUE reader.read_int64(); // Timestamp of the actual assignment.
+
+        res->nodes.reserve(partitions_cnt);
+        for (std::int32_t i = 0; i < partitions_cnt; ++i)
+            res->nodes.emplace_back(reader.read_string_nullable());
+
+        return res;
+    };
+
+    auto callback = [self = shared_from_this()](ignite_result<std::shared_ptr<const partition_assignment>> &&res) {
+        std::vector<ignite_callback<std::shared_ptr<const partition_assignment>>> waiters;
+        {
+            std::lock_guard<std::mutex> lock(self->m_partition_assignment_mutex);
+
+            // Assignment without nodes is not cached, so it is requested again next time.
+            if (res.has_value() && !res.value()->nodes.empty()) {
+                auto &loaded = res.value();
+                if (!self->m_partition_assignment || self->m_partition_assignment->timestamp <= loaded->timestamp)
+                    self->m_partition_assignment = loaded;
+            }
+
+            self->m_partition_assignment_loading.store(false);
+            waiters.swap(self->m_partition_assignment_waiters);
+        }
+
+        for (auto &waiter : waiters) {
+            if (res.has_error())
+                waiter(ignite_error{res.error()});
+            else
+                waiter(std::shared_ptr<const partition_assignment>{res.value()});
+        }
+    };
+
+    try {
+        m_connection->perform_request<std::shared_ptr<const partition_assignment>>(
+            protocol::client_operation::PARTITION_ASSIGNMENT_GET, writer_func, std::move(reader_func),
+            std::move(callback));
+    } catch (const ignite_error &err) {
+        std::vector<ignite_callback<std::shared_ptr<const partition_assignment>>> waiters;
+        {
+            std::lock_guard<std::mutex> lock(m_partition_assignment_mutex);
+
+            m_partition_assignment_loading.store(false);
+            waiters.swap(m_partition_assignment_waiters);
+        }
+
+        for (auto &waiter : waiters)
+            waiter(ignite_error{err});
+    }
+}
+
 void table_impl::get_async(
     transaction *tx, const ignite_tuple &key, ignite_callback<std::optional<ignite_tuple>> callback) {
 
@@ -162,7 +581,8 @@ void table_impl::get_async(
                 });
 
             self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_GET, tx0.get(), writer_func, std::move(handle_func));
+                protocol::client_operation::TUPLE_GET, tx0.get(), writer_func, std::move(handle_func),
+                self->get_preferred_node(tx0.get(), sch, *key));
         });
 }
 
@@ -183,28 +603,37 @@ void table_impl::contains_async(transaction *tx, const ignite_tuple &key, ignite
             };
 
             self->m_connection->perform_request<bool>(protocol::client_operation::TUPLE_CONTAINS_KEY, tx0.get(),
-                writer_func, std::move(reader_func), std::move(callback));
+                writer_func, std::move(reader_func), std::move(callback),
+                self->get_preferred_node(tx0.get(), sch, *key));
         });
 }
 
 void table_impl::get_all_async(transaction *tx, std::vector<ignite_tuple> keys,
     ignite_callback<std::vector<std::optional<ignite_tuple>>> callback) {
 
+    using result_type = std::vector<std::optional<ignite_tuple>>;
+
     auto shared_keys = std::make_shared<std::vector<ignite_tuple>>(std::move(keys));
-    with_proper_schema_async<std::vector<std::optional<ignite_tuple>>>(std::move(callback),
+    with_proper_schema_async<result_type>(std::move(callback),
         [self = shared_from_this(), keys = shared_keys, tx0 = to_impl(tx)](const schema &sch, auto callback) mutable {
-            auto writer_func = [self, keys, &sch, &tx0](protocol::writer &writer) {
-                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
-                write_tuples(writer, sch, *keys, true);
+            auto send = [self, &sch, &tx0](std::shared_ptr<std::vector<ignite_tuple>> keys,
+                            const std::optional<std::string> &node, ignite_callback<result_type> callback) {
+                auto writer_func = [self, keys, &sch, &tx0](protocol::writer &writer) {
+                    write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                    write_tuples(writer, sch, *keys, true);
+                };
+
+                auto handle_func = make_schema_handler_function<result_type>(
+                    self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
+                        callback(read_tuples_opt(reader, &sch, false));
+                    });
+
+                self->m_connection->perform_request_raw(
+                    protocol::client_operation::TUPLE_GET_ALL, tx0.get(), writer_func, std::move(handle_func), node);
             };
 
-            auto handle_func = make_schema_handler_function<std::vector<std::optional<ignite_tuple>>>(
-                self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
-                    callback(read_tuples_opt(reader, &sch, false));
-                });
-
-            self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_GET_ALL, tx0.get(), writer_func, std::move(handle_func));
+            perform_batch_async<result_type>(self->split_by_node(tx0.get(), sch, *keys), keys, std::move(callback),
+                send, merge_by_position<std::optional<ignite_tuple>>);
         });
 }
 
@@ -218,7 +647,8 @@ void table_impl::upsert_async(transaction *tx, const ignite_tuple &record, ignit
             };
 
             self->m_connection->perform_request_wr(
-                protocol::client_operation::TUPLE_UPSERT, tx0.get(), writer_func, std::move(callback));
+                protocol::client_operation::TUPLE_UPSERT, tx0.get(), writer_func, std::move(callback),
+                self->get_preferred_node(tx0.get(), sch, record));
         });
 }
 
@@ -227,13 +657,19 @@ void table_impl::upsert_all_async(transaction *tx, std::vector<ignite_tuple> rec
     with_proper_schema_async<void>(std::move(callback),
         [self = shared_from_this(), records = shared_records, tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
-            auto writer_func = [self, records, &sch, &tx0](protocol::writer &writer) {
-                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
-                write_tuples(writer, sch, *records, false);
+            auto send = [self, &sch, &tx0](std::shared_ptr<std::vector<ignite_tuple>> records,
+                            const std::optional<std::string> &node, ignite_callback<void> callback) {
+                auto writer_func = [self, records, &sch, &tx0](protocol::writer &writer) {
+                    write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                    write_tuples(writer, sch, *records, false);
+                };
+
+                self->m_connection->perform_request_wr(
+                    protocol::client_operation::TUPLE_UPSERT_ALL, tx0.get(), writer_func, std::move(callback), node);
             };
 
-            self->m_connection->perform_request_wr(
-                protocol::client_operation::TUPLE_UPSERT_ALL, tx0.get(), writer_func, std::move(callback));
+            perform_batch_async<void>(
+                self->split_by_node(tx0.get(), sch, *records), records, std::move(callback), send);
         });
 }
 
@@ -254,7 +690,8 @@ void table_impl::get_and_upsert_async(
                 });
 
             self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_GET_AND_UPSERT, tx0.get(), writer_func, std::move(handle_func));
+                protocol::client_operation::TUPLE_GET_AND_UPSERT, tx0.get(), writer_func, std::move(handle_func),
+                self->get_preferred_node(tx0.get(), sch, *record));
         });
 }
 
@@ -274,29 +711,38 @@ void table_impl::insert_async(transaction *tx, const ignite_tuple &record, ignit
             };
 
             self->m_connection->perform_request<bool>(protocol::client_operation::TUPLE_INSERT, tx0.get(), writer_func,
-                std::move(reader_func), std::move(callback));
+                std::move(reader_func), std::move(callback),
+                self->get_preferred_node(tx0.get(), sch, record));
         });
 }
 
 void table_impl::insert_all_async(
     transaction *tx, std::vector<ignite_tuple> records, ignite_callback<std::vector<ignite_tuple>> callback) {
 
+    using result_type = std::vector<ignite_tuple>;
+
     auto shared_records = std::make_shared<std::vector<ignite_tuple>>(std::move(records));
-    with_proper_schema_async<std::vector<ignite_tuple>>(std::move(callback),
+    with_proper_schema_async<result_type>(std::move(callback),
         [self = shared_from_this(), records = shared_records, tx0 = to_impl(tx)](
             const schema &sch, auto callback) mutable {
-            auto writer_func = [self, records, &sch, &tx0](protocol::writer &writer) {
-                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
-                write_tuples(writer, sch, *records, false);
+            auto send = [self, &sch, &tx0](std::shared_ptr<std::vector<ignite_tuple>> records,
+                            const std::optional<std::string> &node, ignite_callback<result_type> callback) {
+                auto writer_func = [self, records, &sch, &tx0](protocol::writer &writer) {
+                    write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                    write_tuples(writer, sch, *records, false);
+                };
+
+                auto handle_func = make_schema_handler_function<result_type>(
+                    self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
+                        callback(read_tuples(reader, &sch, false));
+                    });
+
+                self->m_connection->perform_request_raw(protocol::client_operation::TUPLE_INSERT_ALL, tx0.get(),
+                    writer_func, std::move(handle_func), node);
             };
 
-            auto handle_func = make_schema_handler_function<std::vector<ignite_tuple>>(
-                self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
-                    callback(read_tuples(reader, &sch, false));
-                });
-
-            self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_INSERT_ALL, tx0.get(), writer_func, std::move(handle_func));
+            perform_batch_async<result_type>(self->split_by_node(tx0.get(), sch, *records), records,
+                std::move(callback), send, make_subsequence_merge_function(sch, records));
         });
 }
 
@@ -316,7 +762,8 @@ void table_impl::replace_async(transaction *tx, const ignite_tuple &record, igni
             };
 
             self->m_connection->perform_request<bool>(protocol::client_operation::TUPLE_REPLACE, tx0.get(), writer_func,
-                std::move(reader_func), std::move(callback));
+                std::move(reader_func), std::move(callback),
+                self->get_preferred_node(tx0.get(), sch, record));
         });
 }
 
@@ -338,7 +785,8 @@ void table_impl::replace_async(
             };
 
             self->m_connection->perform_request<bool>(protocol::client_operation::TUPLE_REPLACE_EXACT, tx0.get(),
-                writer_func, std::move(reader_func), std::move(callback));
+                writer_func, std::move(reader_func), std::move(callback),
+                self->get_preferred_node(tx0.get(), sch, record));
         });
 }
 
@@ -359,7 +807,8 @@ void table_impl::get_and_replace_async(
                 });
 
             self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_GET_AND_REPLACE, tx0.get(), writer_func, std::move(handle_func));
+                protocol::client_operation::TUPLE_GET_AND_REPLACE, tx0.get(), writer_func, std::move(handle_func),
+                self->get_preferred_node(tx0.get(), sch, *record));
         });
 }
 
@@ -379,7 +828,8 @@ void table_impl::remove_async(transaction *tx, const ignite_tuple &key, ignite_c
             };
 
             self->m_connection->perform_request<bool>(protocol::client_operation::TUPLE_DELETE, tx0.get(), writer_func,
-                std::move(reader_func), std::move(callback));
+                std::move(reader_func), std::move(callback),
+                self->get_preferred_node(tx0.get(), sch, record));
         });
 }
 
@@ -399,7 +849,8 @@ void table_impl::remove_exact_async(transaction *tx, const ignite_tuple &record,
             };
 
             self->m_connection->perform_request<bool>(protocol::client_operation::TUPLE_DELETE_EXACT, tx0.get(),
-                writer_func, std::move(reader_func), std::move(callback));
+                writer_func, std::move(reader_func), std::move(callback),
+                self->get_preferred_node(tx0.get(), sch, record));
         });
 }
 
@@ -420,47 +871,66 @@ void table_impl::get_and_remove_async(
                 });
 
             self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_GET_AND_DELETE, tx0.get(), writer_func, std::move(handle_func));
+                protocol::client_operation::TUPLE_GET_AND_DELETE, tx0.get(), writer_func, std::move(handle_func),
+                self->get_preferred_node(tx0.get(), sch, *record));
         });
 }
 
 void table_impl::remove_all_async(
     transaction *tx, std::vector<ignite_tuple> keys, ignite_callback<std::vector<ignite_tuple>> callback) {
 
-    with_proper_schema_async<std::vector<ignite_tuple>>(std::move(callback),
-        [self = shared_from_this(), keys = std::move(keys), tx0 = to_impl(tx)](const schema &sch, auto callback) {
-            auto writer_func = [self, &keys, &sch, &tx0](protocol::writer &writer) {
-                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
-                write_tuples(writer, sch, keys, true);
-            };
+    using result_type = std::vector<ignite_tuple>;
 
-            auto handle_func = make_schema_handler_function<std::vector<ignite_tuple>>(
-                self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
-                    callback(read_tuples(reader, &sch, true));
-                });
+    auto shared_keys = std::make_shared<std::vector<ignite_tuple>>(std::move(keys));
+    with_proper_schema_async<result_type>(std::move(callback),
+        [self = shared_from_this(), keys = shared_keys, tx0 = to_impl(tx)](const schema &sch, auto callback) {
+            auto send = [self, &sch, &tx0](std::shared_ptr<std::vector<ignite_tuple>> keys,
+                            const std::optional<std::string> &node, ignite_callback<result_type> callback) {
+                auto writer_func = [self, keys, &sch, &tx0](protocol::writer &writer) {
+                    write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                    write_tuples(writer, sch, *keys, true);
+                };
+
+                auto handle_func = make_schema_handler_function<result_type>(
+                    self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
+                        callback(read_tuples(reader, &sch, true));
+                    });
+
+                self->m_connection->perform_request_raw(protocol::client_operation::TUPLE_DELETE_ALL, tx0.get(),
+                    writer_func, std::move(handle_func), node);
+            };
 
-            self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_DELETE_ALL, tx0.get(), writer_func, std::move(handle_func));
+            perform_batch_async<result_type>(self->split_by_node(tx0.get(), sch, *keys), keys, std::move(callback),
+                send, make_subsequence_merge_function(sch, keys));
         });
 }
 
 void table_impl::remove_all_exact_async(
     transaction *tx, std::vector<ignite_tuple> records, ignite_callback<std::vector<ignite_tuple>> callback) {
 
-    with_proper_schema_async<std::vector<ignite_tuple>>(std::move(callback),
-        [self = shared_from_this(), records = std::move(records), tx0 = to_impl(tx)](const schema &sch, auto callback) {
-            auto writer_func = [self, &records, &sch, &tx0](protocol::writer &writer) {
-                write_table_operation_header(writer, self->m_id, tx0.get(), sch);
-                write_tuples(writer, sch, records, false);
-            };
+    using result_type = std::vector<ignite_tuple>;
 
-            auto handle_func = make_schema_handler_function<std::vector<ignite_tuple>>(
-                self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
-                    callback(read_tuples(reader, &sch, false));
-                });
+    auto shared_records = std::make_shared<std::vector<ignite_tuple>>(std::move(records));
+    with_proper_schema_async<result_type>(std::move(callback),
+        [self = shared_from_this(), records = shared_records, tx0 = to_impl(tx)](const schema &sch, auto callback) {
+            auto send = [self, &sch, &tx0](std::shared_ptr<std::vector<ignite_tuple>> records,
+                            const std::optional<std::string> &node, ignite_callback<result_type> callback) {
+                auto writer_func = [self, records, &sch, &tx0](protocol::writer &writer) {
+                    write_table_operation_header(writer, self->m_id, tx0.get(), sch);
+                    write_tuples(writer, sch, *records, false);
+                };
+
+                auto handle_func = make_schema_handler_function<result_type>(
+                    self, std::move(callback), [](protocol::reader &reader, const schema &sch, auto callback) mutable {
+                        callback(read_tuples(reader, &sch, false));
+                    });
+
+                self->m_connection->perform_request_raw(protocol::client_operation::TUPLE_DELETE_ALL_EXACT, tx0.get(),
+                    writer_func, std::move(handle_func), node);
+            };
 
-            self->m_connection->perform_request_raw(
-                protocol::client_operation::TUPLE_DELETE_ALL_EXACT, tx0.get(), writer_func, std::move(handle_func));
+            perform_batch_async<result_type>(self->split_by_node(tx0.get(), sch, *records), records,
+                std::move(callback), send, make_subsequence_merge_function(sch, records));
         });
 }
 
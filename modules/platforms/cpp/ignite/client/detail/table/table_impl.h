@@ -23,9 +23,13 @@
 #include "ignite/client/transaction/transaction.h"
 #include "ignite/common/uuid.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace ignite {
 class table;
@@ -33,6 +37,17 @@ class table;
 
 namespace ignite::detail {
 
+/**
+ * Part of a batch of tuples that is going to be sent to a single node.
+ */
+struct tuple_batch {
+    /** Name of the node to send the batch to. Not set if the node is unknown. */
+    std::optional<std::string> node;
+
+    /** Indices of the tuples of the batch in the original tuple sequence. */
+    std::vector<std::size_t> indices;
+};
+
 /**
  * Table view implementation.
  */
@@ -363,6 +378,13 @@ public:
      */
     [[nodiscard]] std::int32_t get_id() const { return m_id; }
 
+    /**
+     * Get cluster connection.
+     *
+     * @return Connection.
+     */
+    [[nodiscard]] const std::shared_ptr<cluster_connection> &get_connection() const { return m_connection; }
+
     /**
      * Get schema by version.
      *
@@ -378,7 +400,79 @@ public:
         return it->second;
     }
 
+    /**
+     * Partition assignment.
+     */
+    struct partition_assignment {
+        /** Partition assignment timestamp the assignment was requested for. */
+        std::int64_t timestamp{0};
+
+        /** Number of partitions of the table. */
+        std::int32_t partitions{0};
+
+        /** Primary replica node names by partitions. Empty if the assignment is not available yet. */
+        std::vector<std::optional<std::string>> nodes;
+    };
+
+    /**
+     * Get the cached partition assignment. Starts reloading the assignment if it is outdated.
+     *
+     * @return Partition assignment. Can be nullptr if it was not loaded yet.
+     */
+    [[nodiscard]] std::shared_ptr<const partition_assignment> get_partition_assignment();
+
+    /**
+     * Get the partition assignment, loading it from the server if it was not loaded yet or is outdated.
+     *
+     * @param callback Callback to call with the partition assignment.
+     */
+    void get_partition_assignment_async(ignite_callback<std::shared_ptr<const partition_assignment>> callback);
+
+    /**
+     * Get the name of the node that holds the primary replica of the partition the key belongs to.
+     *
+     * The partition assignment is cached and is reloaded in background when the cluster reports that it has
+     * changed, so the result may be outdated or missing. It is only a hint for choosing the connection.
+     *
+     * @param tx Transaction. If set, the request will be sent using the transaction's connection anyway, so no
+     *  node is returned.
+     * @param sch Schema.
+     * @param key Tuple containing the key columns.
+     * @return Node name or @c std::nullopt if it is unknown.
+     */
+    [[nodiscard]] std::optional<std::string> get_preferred_node(
+        const transaction_impl *tx, const schema &sch, const ignite_tuple &key);
+
+    /**
+     * Split tuples into batches by the node that holds the primary replica of the partition of each tuple.
+     *
+     * @param tx Transaction. If set, all the tuples are sent using the transaction's connection, so no split is done.
+     * @param sch Schema.
+     * @param tuples Tuples containing the key columns.
+     * @return Batches. Contains a single batch with all the tuples if there is nothing to split.
+     */
+    [[nodiscard]] std::vector<tuple_batch> split_by_node(
+        const transaction_impl *tx, const schema &sch, const std::vector<ignite_tuple> &tuples);
+
 private:
+    /**
+     * Get the name of the node that holds the primary replica of the partition the key belongs to.
+     *
+     * @param assignment Partition assignment.
+     * @param sch Schema.
+     * @param key Tuple containing the key columns.
+     * @return Node name or @c std::nullopt if it is unknown.
+     */
+    [[nodiscard]] static std::optional<std::string> get_key_node(
+        const partition_assignment &assignment, const schema &sch, const ignite_tuple &key);
+
+    /**
+     * Load partition assignment from server asynchronously.
+     *
+     * @param timestamp Partition assignment timestamp to request.
+     */
+    void load_partition_assignment_async(std::int64_t timestamp);
+
     /**
      * Load schema from server asynchronously.
      *
@@ -424,6 +518,18 @@ private:
 
     /** Schemas. */
     std::unordered_map<int32_t, std::shared_ptr<schema>> m_schemas;
+
+    /** Partition assignment mutex. */
+    std::mutex m_partition_assignment_mutex;
+
+    /** Partition assignment. */
+    std::shared_ptr<const partition_assignment> m_partition_assignment;
+
+    /** Partition assignment loading flag. */
+    std::atomic_bool m_partition_assignment_loading{false};
+
+    /** Callbacks waiting for the partition assignment being loaded. Guarded by m_partition_assignment_mutex. */
+    std::vector<ignite_callback<std::shared_ptr<const partition_assignment>>> m_partition_assignment_waiters;
 };
 
 } // namespace ignite::detail
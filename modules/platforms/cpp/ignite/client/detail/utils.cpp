@@ -20,6 +20,7 @@
 #include <ignite/client/detail/client_error_flags.h>
 
 #include "ignite/common/detail/bits.h"
+#include "ignite/common/detail/hash_utils.h"
 #include <ignite/common/uuid.h>
 #include <ignite/protocol/utils.h>
 
@@ -27,81 +28,6 @@
 
 namespace ignite::detail {
 
-/**
- * Claim space for the column.
- *
- * @param builder Binary tuple builder.
- * @param typ Column type.
- * @param value Value.
- * @param scale Column scale.
- */
-void claim_column(binary_tuple_builder &builder, ignite_type typ, const primitive &value, std::int32_t scale) {
-    switch (typ) {
-        case ignite_type::BOOLEAN:
-            builder.claim_bool(value.get<bool>());
-            break;
-        case ignite_type::INT8:
-            builder.claim_int8(value.get<std::int8_t>());
-            break;
-        case ignite_type::INT16:
-            builder.claim_int16(value.get<std::int16_t>());
-            break;
-        case ignite_type::INT32:
-            builder.claim_int32(value.get<std::int32_t>());
-            break;
-        case ignite_type::INT64:
-            builder.claim_int64(value.get<std::int64_t>());
-            break;
-        case ignite_type::FLOAT:
-            builder.claim_float(value.get<float>());
-            break;
-        case ignite_type::DOUBLE:
-            builder.claim_double(value.get<double>());
-            break;
-        case ignite_type::UUID:
-            builder.claim_uuid(value.get<uuid>());
-            break;
-        case ignite_type::STRING:
-            builder.claim_varlen(value.get<std::string>());
-            break;
-        case ignite_type::BYTE_ARRAY:
-            builder.claim_varlen(value.get<std::vector<std::byte>>());
-            break;
-        case ignite_type::DECIMAL: {
-            big_decimal to_write;
-            value.get<big_decimal>().set_scale(scale, to_write);
-            builder.claim_number(to_write);
-            break;
-        }
-        case ignite_type::NUMBER:
-            builder.claim_number(value.get<big_integer>());
-            break;
-        case ignite_type::DATE:
-            builder.claim_date(value.get<ignite_date>());
-            break;
-        case ignite_type::TIME:
-            builder.claim_time(value.get<ignite_time>());
-            break;
-        case ignite_type::DATETIME:
-            builder.claim_date_time(value.get<ignite_date_time>());
-            break;
-        case ignite_type::TIMESTAMP:
-            builder.claim_timestamp(value.get<ignite_timestamp>());
-            break;
-        case ignite_type::PERIOD:
-            builder.claim_period(value.get<ignite_period>());
-            break;
-        case ignite_type::DURATION:
-            builder.claim_duration(value.get<ignite_duration>());
-            break;
-        case ignite_type::BITMASK:
-            builder.claim_varlen(value.get<bit_array>().get_raw());
-            break;
-        default:
-            throw ignite_error("Type with id " + std::to_string(int(typ)) + " is not yet supported");
-    }
-}
-
 /**
  * Append column value to binary tuple.
  *
@@ -143,8 +69,14 @@ void append_column(binary_tuple_builder &builder, ignite_type typ, const primiti
             builder.append_varlen(value.get<std::vector<std::byte>>());
             break;
         case ignite_type::DECIMAL: {
+            const auto &dec_value = value.get<big_decimal>();
+            if (dec_value.get_scale() == scale) {
+                builder.append_number(dec_value);
+                break;
+            }
+
             big_decimal to_write;
-            value.get<big_decimal>().set_scale(scale, to_write);
+            dec_value.set_scale(std::int16_t(scale), to_write);
             builder.append_number(to_write);
             break;
         }
@@ -178,75 +110,97 @@ void append_column(binary_tuple_builder &builder, ignite_type typ, const primiti
 }
 
 /**
- * Serialize tuple using table schema.
+ * Throw an error listing the tuple columns which are not present in the schema.
  *
  * @param sch Schema.
  * @param tuple Tuple.
- * @param key_only Should only key fields be serialized.
- * @param no_value No value bitset.
- * @return Serialized binary tuple.
+ * @param col_indices Indices of the schema columns in the tuple.
  */
-std::vector<std::byte> pack_tuple(
-    const schema &sch, const ignite_tuple &tuple, bool key_only, protocol::bitset_span &no_value) {
-    auto count = std::int32_t(key_only ? sch.key_columns.size() : sch.columns.size());
-    binary_tuple_builder builder{count};
-
-    builder.start();
-
-    auto col_indices = reinterpret_cast<std::int32_t *>(alloca(count * sizeof(std::int32_t)));
-    for (std::int32_t i = 0; i < count; ++i) {
-        const auto &col = sch.get_column(key_only, i);
-        auto col_idx = tuple.column_ordinal(col.name);
-        col_indices[i] = col_idx;
+[[noreturn]] void throw_unmapped_columns(
+    const schema &sch, const ignite_tuple &tuple, const std::int32_t *col_indices) {
+    std::vector<bool> written_ind(tuple.column_count(), false);
+    for (std::size_t i = 0; i < sch.columns.size(); ++i) {
+        auto col_idx = col_indices[i];
 
         if (col_idx >= 0)
-            claim_column(builder, col.type, tuple.get(col_idx), col.scale);
-        else
-            builder.claim_null();
+            written_ind[col_idx] = true;
     }
 
-    std::int32_t written = 0;
-    builder.layout();
-    for (std::int32_t i = 0; i < count; ++i) {
-        const auto &col = sch.get_column(key_only, i);
-        auto col_idx = col_indices[i];
+    std::stringstream unmapped_columns;
+    for (std::int32_t i = 0; i < tuple.column_count(); ++i) {
+        if (written_ind[i])
+            continue;
 
-        if (col_idx >= 0) {
-            append_column(builder, col.type, tuple.get(col_idx), col.scale);
-            ++written;
-        } else {
-            builder.append_null();
-            no_value.set(std::size_t(i));
-        }
+        auto &name = tuple.column_name(i);
+        unmapped_columns << name << ",";
     }
+    auto unmapped_columns_str = unmapped_columns.str();
+    unmapped_columns_str.pop_back();
 
-    if (!key_only && written < tuple.column_count()) {
-        std::vector<bool> written_ind(tuple.column_count(), false);
-        for (std::int32_t i = 0; i < count; ++i) {
-            auto col_idx = col_indices[i];
-
-            if (col_idx >= 0)
-                written_ind[col_idx] = true;
-        }
+    assert(!unmapped_columns_str.empty());
+    throw ignite_error("Tuple doesn't match schema: schemaVersion=" + std::to_string(sch.version)
+            + ", extraColumns=" + unmapped_columns_str,
+        std::int32_t(error_flag::UNMAPPED_COLUMNS_PRESENT));
+}
 
-        std::stringstream unmapped_columns;
-        for (std::int32_t i = 0; i < tuple.column_count(); ++i) {
-            if (written_ind[i])
-                continue;
+/**
+ * Calculate a hash of the column value.
+ *
+ * @param col Column.
+ * @param value Value.
+ * @return Hash.
+ */
+std::int32_t hash_column(const column &col, const primitive &value) {
+    if (value.is_null())
+        return hash32(std::int8_t(0));
 
-            auto &name = tuple.column_name(i);
-            unmapped_columns << name << ",";
-        }
-        auto unmapped_columns_str = unmapped_columns.str();
-        unmapped_columns_str.pop_back();
+    switch (col.type) {
+        case ignite_type::BOOLEAN:
+            return hash32(std::int8_t(value.get<bool>() ? 1 : 0));
+        case ignite_type::INT8:
+            return hash32(value.get<std::int8_t>());
+        case ignite_type::INT16:
+            return hash32(value.get<std::int16_t>());
+        case ignite_type::INT32:
+            return hash32(value.get<std::int32_t>());
+        case ignite_type::INT64:
+            return hash32(value.get<std::int64_t>());
+        case ignite_type::FLOAT:
+            return hash32(value.get<float>());
+        case ignite_type::DOUBLE:
+            return hash32(value.get<double>());
+        case ignite_type::UUID:
+            return hash32(value.get<uuid>());
+        case ignite_type::STRING:
+            return hash32(bytes_view{value.get<std::string>()});
+        case ignite_type::BYTE_ARRAY:
+            return hash32(bytes_view{value.get<std::vector<std::byte>>()});
+        case ignite_type::DECIMAL:
+            return hash32(value.get<big_decimal>(), std::int16_t(col.scale));
+        case ignite_type::DATE:
+            return hash32(value.get<ignite_date>());
+        case ignite_type::TIME:
+            return hash32(value.get<ignite_time>(), col.precision);
+        case ignite_type::DATETIME:
+            return hash32(value.get<ignite_date_time>(), col.precision);
+        case ignite_type::TIMESTAMP:
+            return hash32(value.get<ignite_timestamp>(), col.precision);
+        default:
+            throw ignite_error("Type with id " + std::to_string(int(col.type)) + " is not supported for colocation");
+    }
+}
 
-        assert(!unmapped_columns_str.empty());
-        throw ignite_error("Tuple doesn't match schema: schemaVersion=" + std::to_string(sch.version)
-                + ", extraColumns=" + unmapped_columns_str,
-            std::int32_t(error_flag::UNMAPPED_COLUMNS_PRESENT));
+std::int32_t calc_colocation_hash(const schema &sch, const ignite_tuple &tuple) {
+    hash_calculator calc;
+    for (const auto *col : sch.colocation_columns) {
+        auto col_idx = tuple.column_ordinal(col->name);
+        if (col_idx < 0)
+            calc.append_null();
+        else
+            calc.append_hash(hash_column(*col, tuple.get(col_idx)));
     }
 
-    return builder.build();
+    return calc.get_hash();
 }
 
 ignite_tuple concat(const ignite_tuple &left, const ignite_tuple &right) {
@@ -267,22 +221,58 @@ ignite_tuple concat(const ignite_tuple &left, const ignite_tuple &right) {
 }
 
 void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &tuple, bool key_only) {
-    const std::size_t count = key_only ? sch.key_columns.size() : sch.columns.size();
+    binary_tuple_builder builder{std::int32_t(key_only ? sch.key_columns.size() : sch.columns.size())};
+
+    write_tuple(writer, sch, tuple, key_only, builder);
+}
+
+void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &tuple, bool key_only,
+    binary_tuple_builder &builder) {
+    const auto count = builder.num_elements();
+    assert(std::size_t(count) == (key_only ? sch.key_columns.size() : sch.columns.size()));
+
     const std::size_t bytes_num = bytes_for_bits(count);
 
     auto no_value_bytes = reinterpret_cast<std::byte *>(alloca(bytes_num));
     protocol::bitset_span no_value(no_value_bytes, bytes_num);
 
-    auto tuple_data = pack_tuple(sch, tuple, key_only, no_value);
+    auto col_indices = reinterpret_cast<std::int32_t *>(alloca(count * sizeof(std::int32_t)));
+
+    std::int32_t written = 0;
+    for (std::int32_t i = 0; i < count; ++i) {
+        auto col_idx = tuple.column_ordinal(sch.get_column(key_only, i).name);
+        col_indices[i] = col_idx;
+
+        if (col_idx >= 0)
+            ++written;
+        else
+            no_value.set(std::size_t(i));
+    }
+
+    if (!key_only && written < tuple.column_count())
+        throw_unmapped_columns(sch, tuple, col_indices);
 
     writer.write_bitset(no_value.data());
-    writer.write_binary(tuple_data);
+    writer.write_binary_tuple(builder, [&](binary_tuple_builder &tuple_builder) {
+        for (std::int32_t i = 0; i < count; ++i) {
+            auto col_idx = col_indices[i];
+
+            if (col_idx >= 0) {
+                const auto &col = sch.get_column(key_only, i);
+                append_column(tuple_builder, col.type, tuple.get(col_idx), col.scale);
+            } else {
+                tuple_builder.append_null();
+            }
+        }
+    });
 }
 
 void write_tuples(protocol::writer &writer, const schema &sch, const std::vector<ignite_tuple> &tuples, bool key_only) {
+    binary_tuple_builder builder{std::int32_t(key_only ? sch.key_columns.size() : sch.columns.size())};
+
     writer.write(std::int32_t(tuples.size()));
     for (auto &tuple : tuples)
-        write_tuple(writer, sch, tuple, key_only);
+        write_tuple(writer, sch, tuple, key_only, builder);
 }
 
 ignite_tuple read_tuple(protocol::reader &reader, const schema *sch, bool key_only) {
@@ -353,4 +343,16 @@ cluster_node read_cluster_node(protocol::reader &reader) {
     return {std::move(id), std::move(name), end_point{std::move(host), port}};
 }
 
+std::vector<cluster_node> read_cluster_nodes(protocol::reader &reader) {
+    std::vector<cluster_node> nodes;
+    auto size = reader.read_int32();
+    nodes.reserve(std::size_t(size));
+
+    for (std::int32_t node_idx = 0; node_idx < size; ++node_idx) {
+        nodes.emplace_back(read_cluster_node(reader));
+    }
+
+    return nodes;
+}
+
 } // namespace ignite::detail
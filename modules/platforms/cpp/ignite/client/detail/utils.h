@@ -34,6 +34,18 @@ namespace ignite::detail {
  */
 [[nodiscard]] ignite_tuple concat(const ignite_tuple &left, const ignite_tuple &right);
 
+/**
+ * Calculate colocation hash of the tuple.
+ *
+ * Must produce the same value as the server does for the same key, as it is used to find the partition that the
+ * tuple belongs to.
+ *
+ * @param sch Schema.
+ * @param tuple Tuple. Missing colocation columns are treated as nulls.
+ * @return Colocation hash.
+ */
+[[nodiscard]] std::int32_t calc_colocation_hash(const schema &sch, const ignite_tuple &tuple);
+
 /**
  * Write tuple using table schema and writer.
  *
@@ -44,6 +56,18 @@ namespace ignite::detail {
  */
 void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &tuple, bool key_only);
 
+/**
+ * Write tuple using table schema and writer. The tuple is built right in the writer's buffer.
+ *
+ * @param writer Writer.
+ * @param sch Schema.
+ * @param tuple Tuple.
+ * @param key_only Indicates whether only key fields should be written or not.
+ * @param builder Tuple builder for the written number of columns. Reused across the tuples of a batch.
+ */
+void write_tuple(protocol::writer &writer, const schema &sch, const ignite_tuple &tuple, bool key_only,
+    binary_tuple_builder &builder);
+
 /**
  * Write tuples using table schema and writer.
  *
@@ -101,4 +125,12 @@ std::vector<std::optional<ignite_tuple>> read_tuples_opt(protocol::reader &reade
  */
 cluster_node read_cluster_node(protocol::reader &reader);
 
+/**
+ * Read cluster nodes.
+ *
+ * @param reader Reader.
+ * @return Cluster nodes.
+ */
+std::vector<cluster_node> read_cluster_nodes(protocol::reader &reader);
+
 } // namespace ignite::detail
@@ -16,6 +16,7 @@
  */
 
 #include "ignite/client/detail/utils.h"
+#include "ignite/common/detail/hash_utils.h"
 
 #include <gtest/gtest.h>
 
@@ -89,4 +90,62 @@ TEST(client_utils, tuple_write_read_random_order_key_only) {
 
     EXPECT_EQ(std::string("Test value"), res_tuple.get(0));
     EXPECT_EQ(std::int32_t(1337), res_tuple.get(1));
-}
\ No newline at end of file
+}
+
+TEST(client_utils, tuples_write_read_batch) {
+    auto sch = make_test_schema();
+
+    // Values of different sizes change the layout of the tuples written with the same builder.
+    std::vector<ignite_tuple> tuples;
+    for (std::int32_t i = 0; i < 10; ++i) {
+        std::string value(i % 3 ? std::size_t(i) : std::size_t(i) * 1000, 'x');
+        tuples.push_back(ignite_tuple{{"KEY_COL1", std::to_string(i)}, {"KEY_COL2", i}, {"VAL_COL2", value}});
+    }
+
+    std::vector<std::byte> message;
+    protocol::buffer_adapter buffer(message);
+    protocol::writer writer(buffer);
+
+    write_tuples(writer, *sch, tuples, false);
+
+    protocol::reader reader(message);
+    ASSERT_EQ(10, reader.read_int32());
+
+    for (std::int32_t i = 0; i < 10; ++i) {
+        reader.skip(); // Skip bitset
+
+        auto res_tuple = read_tuple(reader, sch.get(), false);
+
+        ASSERT_EQ(4, res_tuple.column_count());
+        EXPECT_EQ(primitive{}, res_tuple.get("VAL_COL1"));
+        EXPECT_EQ(std::to_string(i), res_tuple.get<std::string>("KEY_COL1"));
+        EXPECT_EQ(tuples[i].get("VAL_COL2"), res_tuple.get("VAL_COL2"));
+        EXPECT_EQ(i, res_tuple.get<std::int32_t>("KEY_COL2"));
+    }
+}
+
+TEST(client_utils, colocation_hash_uses_colocation_order) {
+    std::vector<column> columns;
+    columns.push_back(make_column("VAL_COL1", ignite_type::INT32));
+    columns.push_back(make_column("KEY_COL1", ignite_type::STRING, 0));
+    columns.push_back(make_column("KEY_COL2", ignite_type::INT32, 1));
+    columns[1].colocation_index = 1;
+    columns[2].colocation_index = 0;
+
+    auto sch = schema::create_instance(0, std::move(columns));
+
+    ignite_tuple tuple{{"KEY_COL1", std::string("Test value")}, {"KEY_COL2", std::int32_t(1337)}};
+
+    auto expected =
+        hash_combine(hash_combine(0, hash32(std::int32_t(1337))), hash32(bytes_view{std::string("Test value")}));
+    EXPECT_EQ(expected, calc_colocation_hash(*sch, tuple));
+}
+
+TEST(client_utils, colocation_hash_defaults_to_key_columns) {
+    auto sch = make_test_schema();
+
+    ignite_tuple tuple{{"KEY_COL2", std::int32_t(1337)}};
+
+    auto expected = hash_combine(hash_combine(0, hash32(std::int8_t(0))), hash32(std::int32_t(1337)));
+    EXPECT_EQ(expected, calc_colocation_hash(*sch, tuple));
+}
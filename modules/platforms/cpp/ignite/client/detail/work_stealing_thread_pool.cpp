@@ -0,0 +1,145 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/work_stealing_thread_pool.h"
+
+#include <ignite/common/ignite_error.h>
+
+#include <algorithm>
+
+namespace ignite {
+
+std::shared_ptr<callback_executor> callback_executor::make_thread_pool(std::uint32_t threads) {
+    return std::make_shared<detail::work_stealing_thread_pool>(threads);
+}
+
+namespace detail {
+
+namespace {
+
+/** State of the pool the current thread belongs to. */
+thread_local const void *current_pool{nullptr};
+
+/** Index of the current thread within the pool. */
+thread_local std::size_t current_idx{0};
+
+} // namespace
+
+work_stealing_thread_pool::work_stealing_thread_pool(std::uint32_t threads)
+    : m_state(std::make_shared<shared_state>()) {
+    std::size_t count = threads ? threads : std::max(std::thread::hardware_concurrency(), 1u);
+
+    for (std::size_t i = 0; i < count; ++i)
+        m_state->queues.push_back(std::make_unique<task_queue>());
+
+    for (std::size_t i = 0; i < count; ++i)
+        m_threads.emplace_back(&work_stealing_thread_pool::run, m_state, i);
+}
+
+work_stealing_thread_pool::~work_stealing_thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->stopping = true;
+    }
+    m_state->task_added.notify_all();
+
+    for (auto &thread : m_threads) {
+        // The last reference to the pool may be released by one of its own tasks.
+        if (thread.get_id() == std::this_thread::get_id())
+            thread.detach();
+        else
+            thread.join();
+    }
+}
+
+void work_stealing_thread_pool::execute(std::function<void()> task) {
+    auto &state = *m_state;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.stopping)
+            throw ignite_error("Thread pool is stopped");
+    }
+
+    std::size_t idx = current_pool == &state ? current_idx : state.next_queue.fetch_add(1) % state.queues.size();
+    {
+        auto &queue = *state.queues[idx];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    state.pending.fetch_add(1);
+    {
+        // Synchronizes with the waiting threads, so the notification is not lost.
+        std::lock_guard<std::mutex> lock(state.mutex);
+    }
+    state.task_added.notify_one();
+}
+
+void work_stealing_thread_pool::run(std::shared_ptr<shared_state> state, std::size_t idx) {
+    current_pool = state.get();
+    current_idx = idx;
+
+    while (true) {
+        std::function<void()> task;
+        if (try_take(*state, idx, task)) {
+            state->pending.fetch_sub(1);
+
+            try {
+                task();
+            } catch (...) {
+                // Callbacks handle their own errors, nothing to report here.
+            }
+
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->task_added.wait(lock, [&state] { return state->stopping || state->pending.load() > 0; });
+
+        if (state->stopping && state->pending.load() == 0)
+            break;
+    }
+}
+
+bool work_stealing_thread_pool::try_take(shared_state &state, std::size_t idx, std::function<void()> &task) {
+    auto count = state.queues.size();
+    {
+        auto &own = *state.queues[idx];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.front());
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+
+    for (std::size_t i = 1; i < count; ++i) {
+        auto &other = *state.queues[(idx + i) % count];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (!other.tasks.empty()) {
+            task = std::move(other.tasks.back());
+            other.tasks.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace detail
+
+} // namespace ignite
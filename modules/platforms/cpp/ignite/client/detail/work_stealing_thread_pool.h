@@ -0,0 +1,133 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/client/callback_executor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Work-stealing thread pool.
+ *
+ * Every thread has its own task queue. A thread takes tasks from the front of its own queue, and when it is empty,
+ * from the back of the queues of the other threads.
+ */
+class work_stealing_thread_pool final : public callback_executor {
+public:
+    // Deleted
+    work_stealing_thread_pool(const work_stealing_thread_pool &) = delete;
+    work_stealing_thread_pool &operator=(const work_stealing_thread_pool &) = delete;
+
+    /**
+     * Constructor. Starts the threads.
+     *
+     * @param threads Number of threads. Zero means the number of hardware threads.
+     */
+    explicit work_stealing_thread_pool(std::uint32_t threads);
+
+    /**
+     * Destructor. Executes the remaining tasks and stops the threads.
+     */
+    ~work_stealing_thread_pool() override;
+
+    /**
+     * Schedule execution of the task.
+     *
+     * @param task Task.
+     * @throw ignite_error if the pool is stopped.
+     */
+    void execute(std::function<void()> task) override;
+
+    /**
+     * Get the number of threads.
+     *
+     * @return Number of threads.
+     */
+    [[nodiscard]] std::size_t get_thread_count() const { return m_threads.size(); }
+
+private:
+    /**
+     * Task queue of a thread.
+     */
+    struct task_queue {
+        /** Queue mutex. */
+        std::mutex mutex;
+
+        /** Tasks. */
+        std::deque<std::function<void()>> tasks;
+    };
+
+    /**
+     * State shared with the threads. Outlives the pool if it is destroyed by one of its own tasks.
+     */
+    struct shared_state {
+        /** Task queues, one per thread. */
+        std::vector<std::unique_ptr<task_queue>> queues;
+
+        /** Queue to put the next task scheduled from outside the pool to. */
+        std::atomic_size_t next_queue{0};
+
+        /** Number of tasks in the queues. */
+        std::atomic_size_t pending{0};
+
+        /** Stop flag. Protected by mutex. */
+        bool stopping{false};
+
+        /** Mutex the idle threads wait on. */
+        std::mutex mutex;
+
+        /** Condition variable the idle threads wait on. */
+        std::condition_variable task_added;
+    };
+
+    /**
+     * Run the thread.
+     *
+     * @param state Shared state.
+     * @param idx Index of the thread.
+     */
+    static void run(std::shared_ptr<shared_state> state, std::size_t idx);
+
+    /**
+     * Take a task from the own queue of the thread or steal one from the others.
+     *
+     * @param state Shared state.
+     * @param idx Index of the thread.
+     * @param task Task.
+     * @return @c true if a task was taken.
+     */
+    static bool try_take(shared_state &state, std::size_t idx, std::function<void()> &task);
+
+    /** Shared state. */
+    std::shared_ptr<shared_state> m_state;
+
+    /** Threads. */
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace ignite::detail
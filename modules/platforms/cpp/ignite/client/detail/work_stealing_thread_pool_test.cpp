@@ -0,0 +1,98 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/detail/work_stealing_thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+
+using namespace ignite;
+using namespace ignite::detail;
+
+TEST(work_stealing_thread_pool, executes_all_tasks) {
+    std::atomic_int counter{0};
+    {
+        work_stealing_thread_pool pool(4);
+        EXPECT_EQ(4, pool.get_thread_count());
+
+        for (int i = 0; i < 1000; ++i)
+            pool.execute([&counter] { ++counter; });
+    }
+
+    // Remaining tasks are executed on destruction.
+    EXPECT_EQ(1000, counter.load());
+}
+
+TEST(work_stealing_thread_pool, tasks_scheduled_from_tasks) {
+    std::atomic_int counter{0};
+    std::promise<void> done;
+    {
+        work_stealing_thread_pool pool(2);
+
+        pool.execute([&] {
+            for (int i = 0; i < 100; ++i) {
+                pool.execute([&] {
+                    if (++counter == 100)
+                        done.set_value();
+                });
+            }
+        });
+
+        done.get_future().wait();
+    }
+
+    EXPECT_EQ(100, counter.load());
+}
+
+TEST(work_stealing_thread_pool, idle_thread_steals_from_busy_one) {
+    work_stealing_thread_pool pool(2);
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> stolen;
+
+    // Both tasks end up in the queue of the blocked thread, so the second one only runs if it is stolen.
+    pool.execute([&pool, released, &stolen] {
+        pool.execute([&stolen] { stolen.set_value(); });
+        released.wait();
+    });
+
+    EXPECT_EQ(std::future_status::ready, stolen.get_future().wait_for(std::chrono::seconds(10)));
+    release.set_value();
+}
+
+TEST(work_stealing_thread_pool, task_exceptions_are_ignored) {
+    std::promise<void> done;
+    work_stealing_thread_pool pool(1);
+
+    pool.execute([] { throw std::runtime_error("Test"); });
+    pool.execute([&done] { done.set_value(); });
+
+    EXPECT_EQ(std::future_status::ready, done.get_future().wait_for(std::chrono::seconds(10)));
+}
+
+TEST(work_stealing_thread_pool, make_thread_pool) {
+    auto executor = callback_executor::make_thread_pool(0);
+    ASSERT_TRUE(executor);
+
+    std::promise<void> done;
+    executor->execute([&done] { done.set_value(); });
+
+    EXPECT_EQ(std::future_status::ready, done.get_future().wait_for(std::chrono::seconds(10)));
+}
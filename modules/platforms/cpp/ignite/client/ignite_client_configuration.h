@@ -17,10 +17,15 @@
 
 #pragma once
 
+#include <ignite/client/balancing_policy.h>
+#include <ignite/client/callback_executor.h>
 #include <ignite/client/ignite_client_authenticator.h>
 #include <ignite/client/ignite_logger.h>
+#include <ignite/client/retry_policy.h>
 #include <ignite/client/ssl_mode.h>
 
+#include <chrono>
+#include <cstddef>
 #include <initializer_list>
 #include <memory>
 #include <string>
@@ -140,6 +145,211 @@ public:
      */
     void set_connection_limit(uint32_t limit) { m_connection_limit = limit; }
 
+    /**
+     * Get number of connections per node.
+     *
+     * @return Number of connections per node.
+     */
+    [[nodiscard]] uint32_t get_connections_per_node() const { return m_connections_per_node; }
+
+    /**
+     * Set number of connections per node.
+     *
+     * Several connections to the same node help when a single connection is a bottleneck, e.g. with large values.
+     * Requests for a specific node go over its connection with the least number of requests awaiting a response,
+     * other requests are distributed according to the balancing policy. Requests within a transaction always use
+     * the connection the transaction was started with. The connection limit, if set, counts every connection.
+     *
+     * The default value is one.
+     *
+     * @param connections Number of connections per node. Zero is treated as one.
+     */
+    void set_connections_per_node(uint32_t connections) { m_connections_per_node = connections; }
+
+    /**
+     * Get number of IO threads.
+     *
+     * @return Number of IO threads.
+     */
+    [[nodiscard]] uint32_t get_io_threads() const { return m_io_threads; }
+
+    /**
+     * Set number of IO threads.
+     *
+     * Every IO thread has its own event loop and serves its own share of connections, which are distributed
+     * between threads by server address. Responses, including user callbacks, are processed on these threads.
+     * The number of threads never exceeds the connection limit, if set. Ignored on Windows.
+     *
+     * The default value is one.
+     *
+     * @param threads Number of IO threads. Zero is treated as one.
+     */
+    void set_io_threads(uint32_t threads) { m_io_threads = threads; }
+
+    /**
+     * Check whether edge-triggered IO notifications are used.
+     *
+     * @return @c true if edge-triggered IO notifications are used.
+     */
+    [[nodiscard]] bool is_edge_triggered_io() const { return m_edge_triggered_io; }
+
+    /**
+     * Set whether edge-triggered IO notifications are used.
+     *
+     * With edge-triggered notifications, an IO thread reads a connection until there is no more data available
+     * every time it is notified, so large responses need less wakeups, and it is only notified of the writable
+     * socket when a write is blocked. Ignored on Windows.
+     *
+     * By default, level-triggered notifications are used.
+     *
+     * @param enabled Whether edge-triggered IO notifications are used.
+     */
+    void set_edge_triggered_io(bool enabled) { m_edge_triggered_io = enabled; }
+
+    /**
+     * Get the maximum number of IO events an IO thread handles per single poll.
+     *
+     * @return Maximum number of IO events.
+     */
+    [[nodiscard]] uint32_t get_max_io_events() const { return m_max_io_events; }
+
+    /**
+     * Set the maximum number of IO events an IO thread handles per single poll.
+     *
+     * Larger values mean less polls when many connections are active at once. Ignored on Windows.
+     *
+     * The default value is 16.
+     *
+     * @param events Maximum number of IO events. Zero is treated as one.
+     */
+    void set_max_io_events(uint32_t events) { m_max_io_events = events; }
+
+    /**
+     * Check whether io_uring is used for IO.
+     *
+     * @return @c true if io_uring is requested.
+     */
+    [[nodiscard]] bool is_io_uring_enabled() const { return m_io_uring_enabled; }
+
+    /**
+     * Set whether io_uring is used for IO.
+     *
+     * With io_uring, established connections receive data with multishot receive operations into buffers shared
+     * by the connections of an IO thread, and the sends of many connections are submitted with a single system
+     * call. This cuts the number of system calls with many connections. Connections are still established with
+     * epoll. If io_uring is not supported by the system, epoll is used. Only supported on Linux.
+     *
+     * By default, epoll is used.
+     *
+     * @param enabled Whether io_uring is used.
+     */
+    void set_io_uring_enabled(bool enabled) { m_io_uring_enabled = enabled; }
+
+    /**
+     * Get the busy polling duration.
+     *
+     * @return Busy polling duration. Zero means busy polling is disabled.
+     */
+    [[nodiscard]] std::chrono::microseconds get_busy_poll_duration() const { return m_busy_poll_duration; }
+
+    /**
+     * Set the busy polling duration.
+     *
+     * With busy polling, an IO thread keeps polling for events without blocking for the specified duration before
+     * it blocks, so it picks up responses without the wakeup latency, and the threads performing requests try to
+     * send right away even when the previous requests of the connection are still waiting to be sent. This trades
+     * CPU time for latency. Ignored on Windows.
+     *
+     * By default, busy polling is disabled.
+     *
+     * @param duration Busy polling duration. Zero means busy polling is disabled.
+     */
+    void set_busy_poll_duration(std::chrono::microseconds duration) { m_busy_poll_duration = duration; }
+
+    /**
+     * Check whether the low latency socket options are set.
+     *
+     * @return @c true if the low latency socket options are set.
+     */
+    [[nodiscard]] bool is_low_latency_socket_options() const { return m_low_latency_socket_options; }
+
+    /**
+     * Set whether the low latency socket options are set.
+     *
+     * The options are SO_BUSY_POLL with the busy polling duration, so the kernel polls the device queue on reads,
+     * and TCP_QUICKACK, so the received data is acknowledged right away. Options which are not supported by the
+     * system are skipped. Only supported on Linux.
+     *
+     * By default, the options are not set.
+     *
+     * @param enabled Whether the low latency socket options are set.
+     */
+    void set_low_latency_socket_options(bool enabled) { m_low_latency_socket_options = enabled; }
+
+    /**
+     * Get the write combining flush delay.
+     *
+     * @return Flush delay. Zero if write combining is disabled.
+     */
+    [[nodiscard]] std::chrono::microseconds get_write_combining_delay() const { return m_write_combining_delay; }
+
+    /**
+     * Set the write combining flush delay.
+     *
+     * With write combining, requests sent over a connection are held back for up to the flush delay, and the
+     * requests issued during that time, e.g. by concurrent threads, are written to the socket with a single system
+     * call. This improves the throughput of small requests at the cost of the latency bounded by the delay. Ignored
+     * on Windows.
+     *
+     * By default, write combining is disabled.
+     *
+     * @param delay Flush delay. Zero disables write combining.
+     */
+    void set_write_combining_delay(std::chrono::microseconds delay) { m_write_combining_delay = delay; }
+
+    /**
+     * Get the write combining size threshold.
+     *
+     * @return Size threshold in bytes.
+     */
+    [[nodiscard]] std::size_t get_write_combining_threshold() const { return m_write_combining_threshold; }
+
+    /**
+     * Set the write combining size threshold.
+     *
+     * Once the size of the requests held back for a connection reaches the threshold, they are sent right away
+     * without waiting for the flush delay to pass.
+     *
+     * The default value is 64 KiB.
+     *
+     * @param threshold Size threshold in bytes.
+     */
+    void set_write_combining_threshold(std::size_t threshold) { m_write_combining_threshold = threshold; }
+
+    /**
+     * Get the executor of the callbacks.
+     *
+     * @return Executor. Null if callbacks are invoked on the IO threads.
+     */
+    [[nodiscard]] const std::shared_ptr<callback_executor> &get_callback_executor() const {
+        return m_callback_executor;
+    }
+
+    /**
+     * Set the executor of the callbacks.
+     *
+     * Responses are decoded on the IO threads, and the callbacks passed to the asynchronous API are invoked by the
+     * executor, so slow callbacks do not delay the processing of other responses. The built-in work-stealing thread
+     * pool is made by callback_executor::make_thread_pool().
+     *
+     * By default, callbacks are invoked on the IO threads.
+     *
+     * @param executor Executor. Null to invoke callbacks on the IO threads.
+     */
+    void set_callback_executor(std::shared_ptr<callback_executor> executor) {
+        m_callback_executor = std::move(executor);
+    }
+
     /**
      * Gets the authenticator.
      *
@@ -158,6 +368,143 @@ public:
         m_authenticator = std::move(authenticator);
     }
 
+    /**
+     * Get balancing policy.
+     *
+     * @see balancing_policy for details.
+     *
+     * @return Balancing policy.
+     */
+    [[nodiscard]] balancing_policy get_balancing_policy() const { return m_balancing_policy; }
+
+    /**
+     * Set balancing policy.
+     *
+     * @see balancing_policy for details.
+     *
+     * Default is balancing_policy::RANDOM.
+     *
+     * @param policy Balancing policy.
+     */
+    void set_balancing_policy(balancing_policy policy) { m_balancing_policy = policy; }
+
+    /**
+     * Get operation timeout.
+     *
+     * @return Operation timeout. Zero means no timeout.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_operation_timeout() const { return m_operation_timeout; }
+
+    /**
+     * Set operation timeout.
+     *
+     * If no response is received within the timeout, the operation fails with error::code::CONNECTION. The timeout
+     * bounds the whole operation: the retries made according to the retry policy only get the time which is left,
+     * and no retry is made once it is out. Some operations can override the timeout, e.g. SQL queries use the
+     * statement timeout if one is set. The timeout is checked with a granularity of about 100 milliseconds.
+     *
+     * Default is zero, which means no timeout.
+     *
+     * @param timeout Operation timeout. Must not be negative.
+     */
+    void set_operation_timeout(std::chrono::milliseconds timeout) { m_operation_timeout = timeout; }
+
+    /**
+     * Get heartbeat interval.
+     *
+     * @return Heartbeat interval. Zero means heartbeats are disabled.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_heartbeat_interval() const { return m_heartbeat_interval; }
+
+    /**
+     * Set heartbeat interval.
+     *
+     * A heartbeat is sent when nothing was received over a connection for this interval. If the server closes idle
+     * connections, a third of the server idle timeout is used when it is less than the configured interval.
+     *
+     * Default is 30 seconds.
+     *
+     * @param interval Heartbeat interval. Zero disables heartbeats.
+     */
+    void set_heartbeat_interval(std::chrono::milliseconds interval) { m_heartbeat_interval = interval; }
+
+    /**
+     * Get heartbeat timeout.
+     *
+     * @return Heartbeat timeout.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_heartbeat_timeout() const { return m_heartbeat_timeout; }
+
+    /**
+     * Set heartbeat timeout.
+     *
+     * If there is no response to a heartbeat within the timeout, the connection is considered dead and is closed,
+     * so requests are routed to other connections.
+     *
+     * Default is 5 seconds.
+     *
+     * @param timeout Heartbeat timeout. Must be positive.
+     */
+    void set_heartbeat_timeout(std::chrono::milliseconds timeout) { m_heartbeat_timeout = timeout; }
+
+    /**
+     * Get retry policy.
+     *
+     * @see retry_policy for details.
+     *
+     * @return Retry policy.
+     */
+    [[nodiscard]] const retry_policy &get_retry_policy() const { return m_retry_policy; }
+
+    /**
+     * Set retry policy.
+     *
+     * @see retry_policy for details.
+     *
+     * Default policy retries idempotent reads failed because of a connection error.
+     *
+     * @param policy Retry policy.
+     */
+    void set_retry_policy(retry_policy policy) { m_retry_policy = std::move(policy); }
+
+    /**
+     * Check whether topology discovery is enabled.
+     *
+     * @return @c true if topology discovery is enabled.
+     */
+    [[nodiscard]] bool is_topology_discovery_enabled() const { return m_topology_discovery_enabled; }
+
+    /**
+     * Enable or disable topology discovery.
+     *
+     * When enabled, the client requests the cluster nodes after the first connection is established and then
+     * periodically, and connects to the nodes that are not listed in the endpoints. The total number of connections
+     * is still limited by the connection limit, if one is set. Node addresses must be reachable from the client.
+     *
+     * Default is @c false.
+     *
+     * @param enabled Whether topology discovery is enabled.
+     */
+    void set_topology_discovery_enabled(bool enabled) { m_topology_discovery_enabled = enabled; }
+
+    /**
+     * Get topology refresh interval.
+     *
+     * @return Topology refresh interval.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_topology_refresh_interval() const {
+        return m_topology_refresh_interval;
+    }
+
+    /**
+     * Set topology refresh interval. Only used when topology discovery is enabled.
+     *
+     * Default is 30 seconds.
+     *
+     * @param interval Topology refresh interval. Must be positive.
+     */
+    void set_topology_refresh_interval(std::chrono::milliseconds interval) { m_topology_refresh_interval = interval; }
+
     /**
      * Get SSL mode.
      *
@@ -250,6 +597,57 @@ private:
     /** Active connections limit. */
     uint32_t m_connection_limit{0};
 
+    /** Number of connections per node. */
+    uint32_t m_connections_per_node{1};
+
+    /** Number of IO threads. */
+    uint32_t m_io_threads{1};
+
+    /** Whether edge-triggered IO notifications are used. */
+    bool m_edge_triggered_io{false};
+
+    /** Maximum number of IO events handled per single poll. */
+    uint32_t m_max_io_events{16};
+
+    /** Whether io_uring is used for IO. */
+    bool m_io_uring_enabled{false};
+
+    /** Busy polling duration. */
+    std::chrono::microseconds m_busy_poll_duration{0};
+
+    /** Whether the low latency socket options are set. */
+    bool m_low_latency_socket_options{false};
+
+    /** Write combining flush delay. */
+    std::chrono::microseconds m_write_combining_delay{0};
+
+    /** Write combining size threshold. */
+    std::size_t m_write_combining_threshold{64 * 1024};
+
+    /** Executor of the callbacks. */
+    std::shared_ptr<callback_executor> m_callback_executor{};
+
+    /** Balancing policy. */
+    balancing_policy m_balancing_policy{balancing_policy::RANDOM};
+
+    /** Operation timeout. */
+    std::chrono::milliseconds m_operation_timeout{0};
+
+    /** Heartbeat interval. */
+    std::chrono::milliseconds m_heartbeat_interval{std::chrono::seconds(30)};
+
+    /** Heartbeat timeout. */
+    std::chrono::milliseconds m_heartbeat_timeout{std::chrono::seconds(5)};
+
+    /** Retry policy. */
+    retry_policy m_retry_policy;
+
+    /** Topology discovery flag. */
+    bool m_topology_discovery_enabled{false};
+
+    /** Topology refresh interval. */
+    std::chrono::milliseconds m_topology_refresh_interval{std::chrono::seconds(30)};
+
     /** SSL Mode. */
     ssl_mode m_ssl_mode{ssl_mode::DISABLE};
 
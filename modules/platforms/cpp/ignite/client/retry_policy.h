@@ -0,0 +1,248 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file
+ * Declares ignite::retry_policy.
+ */
+
+#pragma once
+
+#include <ignite/client/client_operation_type.h>
+
+#include <ignite/common/error_codes.h>
+#include <ignite/common/ignite_error.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace ignite {
+
+/**
+ * Context of a failed attempt to perform an operation.
+ */
+struct retry_context {
+    /** Operation type. */
+    client_operation_type operation;
+
+    /** Number of the failed attempt, starting with 1. */
+    std::int32_t attempt;
+
+    /** Error the attempt failed with. */
+    const ignite_error &error;
+};
+
+/**
+ * Retry policy.
+ *
+ * Decides whether a failed operation is transparently re-sent, possibly over another connection, instead of
+ * reporting the error to the caller. Operations within an explicit transaction are never retried as they are bound
+ * to the connection of the transaction.
+ *
+ * A request which may be retried is kept encoded until it completes, so only the operations accepted by the
+ * operation filter pay for it. The predicate is only called for these operations.
+ */
+class retry_policy {
+public:
+    /** Default retry limit. */
+    static constexpr std::int32_t DEFAULT_RETRY_LIMIT = 16;
+
+    /** Default initial backoff. */
+    static constexpr std::chrono::milliseconds DEFAULT_INITIAL_BACKOFF{50};
+
+    /** Default max backoff. */
+    static constexpr std::chrono::milliseconds DEFAULT_MAX_BACKOFF{1000};
+
+    /** Retry predicate type. */
+    typedef std::function<bool(const retry_context &)> predicate_type;
+
+    /** Operation filter type. */
+    typedef std::function<bool(client_operation_type)> operation_filter_type;
+
+    /**
+     * Default constructor.
+     *
+     * Default policy retries idempotent reads failed because of a connection error up to 16 times.
+     * @see is_idempotent_read.
+     */
+    retry_policy() = default;
+
+    /**
+     * Check whether the operation is an idempotent read failed because of a connection error.
+     *
+     * @param ctx Retry context.
+     * @return @c true if the operation can be retried.
+     */
+    [[nodiscard]] static bool is_idempotent_read(const retry_context &ctx) {
+        return ctx.error.get_status_code() == error::code::CONNECTION && is_idempotent_read_operation(ctx.operation);
+    }
+
+    /**
+     * Check whether the operation is an idempotent read.
+     *
+     * @param operation Operation type.
+     * @return @c true if the operation is an idempotent read.
+     */
+    [[nodiscard]] static bool is_idempotent_read_operation(client_operation_type operation) {
+        switch (operation) {
+            case client_operation_type::TABLES_GET:
+            case client_operation_type::TABLE_GET:
+            case client_operation_type::SCHEMAS_GET:
+            case client_operation_type::TUPLE_GET:
+            case client_operation_type::TUPLE_GET_ALL:
+            case client_operation_type::TUPLE_CONTAINS_KEY:
+            case client_operation_type::JDBC_TABLE_META:
+            case client_operation_type::JDBC_COLUMN_META:
+            case client_operation_type::JDBC_PK_META:
+            case client_operation_type::CLUSTER_GET_NODES:
+            case client_operation_type::PARTITION_ASSIGNMENT_GET:
+            case client_operation_type::SQL_QUERY_META:
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Get the max number of retries of a single operation.
+     *
+     * @return Retry limit.
+     */
+    [[nodiscard]] std::int32_t get_retry_limit() const { return m_retry_limit; }
+
+    /**
+     * Set the max number of retries of a single operation.
+     *
+     * @param limit Retry limit. Zero disables retries.
+     */
+    void set_retry_limit(std::int32_t limit) { m_retry_limit = limit; }
+
+    /**
+     * Get the delay before the first retry.
+     *
+     * @return Initial backoff.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_initial_backoff() const { return m_initial_backoff; }
+
+    /**
+     * Set the delay before the first retry. The delay is doubled for every next retry of the same operation.
+     * Non-zero delays are applied with a granularity of about 100 milliseconds.
+     *
+     * @param backoff Initial backoff. Zero means retrying immediately.
+     */
+    void set_initial_backoff(std::chrono::milliseconds backoff) { m_initial_backoff = backoff; }
+
+    /**
+     * Get the max delay before a retry.
+     *
+     * @return Max backoff.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_max_backoff() const { return m_max_backoff; }
+
+    /**
+     * Set the max delay before a retry.
+     *
+     * @param backoff Max backoff.
+     */
+    void set_max_backoff(std::chrono::milliseconds backoff) { m_max_backoff = backoff; }
+
+    /**
+     * Get the predicate deciding whether a failed operation is retried.
+     *
+     * @return Predicate.
+     */
+    [[nodiscard]] const predicate_type &get_predicate() const { return m_predicate; }
+
+    /**
+     * Set the predicate deciding whether a failed operation is retried. Called on the IO thread, must not block.
+     * The retry limit is checked before the predicate is called.
+     *
+     * @param predicate Predicate.
+     */
+    void set_predicate(predicate_type predicate) { m_predicate = std::move(predicate); }
+
+    /**
+     * Get the filter selecting the operations which may be retried.
+     *
+     * @return Operation filter.
+     */
+    [[nodiscard]] const operation_filter_type &get_operation_filter() const { return m_operation_filter; }
+
+    /**
+     * Set the filter selecting the operations which may be retried. The predicate is only called for the
+     * operations accepted by the filter, so it should be set along with the predicate which retries other
+     * operations than the idempotent reads. Called on the thread performing the operation, must not block.
+     *
+     * @param filter Operation filter.
+     */
+    void set_operation_filter(operation_filter_type filter) { m_operation_filter = std::move(filter); }
+
+    /**
+     * Check whether a request of the operation may be retried if it fails.
+     *
+     * @param operation Operation type.
+     * @return @c true if the operation may be retried.
+     */
+    [[nodiscard]] bool may_retry(client_operation_type operation) const {
+        return m_retry_limit > 0 && m_predicate && m_operation_filter && m_operation_filter(operation);
+    }
+
+    /**
+     * Check whether a failed operation should be retried.
+     *
+     * @param ctx Retry context.
+     * @return @c true if the operation should be retried.
+     */
+    [[nodiscard]] bool should_retry(const retry_context &ctx) const {
+        return ctx.attempt <= m_retry_limit && m_predicate && m_predicate(ctx);
+    }
+
+    /**
+     * Get the delay before the retry following the failed attempt.
+     *
+     * @param attempt Number of the failed attempt, starting with 1.
+     * @return Backoff.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_backoff(std::int32_t attempt) const {
+        auto backoff = m_initial_backoff;
+        for (std::int32_t i = 1; i < attempt && backoff < m_max_backoff; ++i)
+            backoff *= 2;
+
+        return std::min(backoff, m_max_backoff);
+    }
+
+private:
+    /** Retry limit. */
+    std::int32_t m_retry_limit{DEFAULT_RETRY_LIMIT};
+
+    /** Initial backoff. */
+    std::chrono::milliseconds m_initial_backoff{DEFAULT_INITIAL_BACKOFF};
+
+    /** Max backoff. */
+    std::chrono::milliseconds m_max_backoff{DEFAULT_MAX_BACKOFF};
+
+    /** Predicate. */
+    predicate_type m_predicate{&retry_policy::is_idempotent_read};
+
+    /** Operation filter. */
+    operation_filter_type m_operation_filter{&retry_policy::is_idempotent_read_operation};
+};
+
+} // namespace ignite
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/client/retry_policy.h"
+
+#include <gtest/gtest.h>
+
+using namespace ignite;
+using namespace std::chrono_literals;
+
+TEST(retry_policy, default_predicate_retries_idempotent_reads) {
+    retry_policy policy;
+    ignite_error conn_err(error::code::CONNECTION, "Connection closed");
+    ignite_error other_err(error::code::INTERNAL, "Internal error");
+
+    EXPECT_TRUE(policy.should_retry({client_operation_type::TUPLE_GET, 1, conn_err}));
+    EXPECT_TRUE(policy.should_retry({client_operation_type::TUPLE_GET_ALL, 1, conn_err}));
+    EXPECT_TRUE(policy.should_retry({client_operation_type::TUPLE_CONTAINS_KEY, 1, conn_err}));
+    EXPECT_TRUE(policy.should_retry({client_operation_type::SQL_QUERY_META, 1, conn_err}));
+    EXPECT_TRUE(policy.should_retry({client_operation_type::SCHEMAS_GET, 1, conn_err}));
+
+    EXPECT_FALSE(policy.should_retry({client_operation_type::TUPLE_UPSERT, 1, conn_err}));
+    EXPECT_FALSE(policy.should_retry({client_operation_type::SQL_EXEC, 1, conn_err}));
+    EXPECT_FALSE(policy.should_retry({client_operation_type::TUPLE_GET, 1, other_err}));
+}
+
+TEST(retry_policy, retry_limit) {
+    retry_policy policy;
+    policy.set_retry_limit(2);
+    ignite_error err(error::code::CONNECTION, "Connection closed");
+
+    EXPECT_TRUE(policy.should_retry({client_operation_type::TUPLE_GET, 1, err}));
+    EXPECT_TRUE(policy.should_retry({client_operation_type::TUPLE_GET, 2, err}));
+    EXPECT_FALSE(policy.should_retry({client_operation_type::TUPLE_GET, 3, err}));
+}
+
+TEST(retry_policy, custom_predicate) {
+    retry_policy policy;
+    policy.set_predicate([](const retry_context &ctx) { return ctx.operation == client_operation_type::TUPLE_UPSERT; });
+    ignite_error err(error::code::INTERNAL, "Internal error");
+
+    EXPECT_TRUE(policy.should_retry({client_operation_type::TUPLE_UPSERT, 1, err}));
+    EXPECT_FALSE(policy.should_retry({client_operation_type::TUPLE_GET, 1, err}));
+}
+
+TEST(retry_policy, default_operation_filter_accepts_idempotent_reads) {
+    retry_policy policy;
+
+    EXPECT_TRUE(policy.may_retry(client_operation_type::TUPLE_GET));
+    EXPECT_TRUE(policy.may_retry(client_operation_type::TABLES_GET));
+
+    EXPECT_FALSE(policy.may_retry(client_operation_type::TUPLE_UPSERT));
+    EXPECT_FALSE(policy.may_retry(client_operation_type::STREAMER_BATCH_SEND));
+    EXPECT_FALSE(policy.may_retry(client_operation_type::SQL_EXEC));
+}
+
+TEST(retry_policy, no_retries_without_limit_predicate_or_filter) {
+    retry_policy policy;
+    policy.set_retry_limit(0);
+    EXPECT_FALSE(policy.may_retry(client_operation_type::TUPLE_GET));
+
+    policy.set_retry_limit(1);
+    policy.set_predicate(nullptr);
+    EXPECT_FALSE(policy.may_retry(client_operation_type::TUPLE_GET));
+
+    policy.set_predicate(&retry_policy::is_idempotent_read);
+    policy.set_operation_filter(nullptr);
+    EXPECT_FALSE(policy.may_retry(client_operation_type::TUPLE_GET));
+}
+
+TEST(retry_policy, custom_operation_filter) {
+    retry_policy policy;
+    policy.set_operation_filter([](client_operation_type op) { return op == client_operation_type::TUPLE_UPSERT; });
+
+    EXPECT_TRUE(policy.may_retry(client_operation_type::TUPLE_UPSERT));
+    EXPECT_FALSE(policy.may_retry(client_operation_type::TUPLE_GET));
+}
+
+TEST(retry_policy, backoff) {
+    retry_policy policy;
+    policy.set_initial_backoff(100ms);
+    policy.set_max_backoff(500ms);
+
+    EXPECT_EQ(100ms, policy.get_backoff(1));
+    EXPECT_EQ(200ms, policy.get_backoff(2));
+    EXPECT_EQ(400ms, policy.get_backoff(3));
+    EXPECT_EQ(500ms, policy.get_backoff(4));
+    EXPECT_EQ(500ms, policy.get_backoff(100));
+
+    policy.set_initial_backoff(0ms);
+    EXPECT_EQ(0ms, policy.get_backoff(5));
+}
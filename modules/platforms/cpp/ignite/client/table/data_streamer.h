@@ -0,0 +1,194 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <ignite/client/detail/type_mapping_utils.h>
+#include <ignite/client/table/ignite_tuple.h>
+#include <ignite/client/type_mapping.h>
+
+#include "ignite/common/detail/config.h"
+#include <ignite/common/ignite_result.h>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ignite {
+
+namespace detail {
+class data_streamer_impl;
+}
+
+template<typename T>
+class record_view;
+
+/**
+ * Data streamer operation type.
+ */
+enum class data_streamer_operation_type {
+    /// Insert the record or replace the existing one.
+    PUT = 0,
+
+    /// Remove the record with the same key.
+    REMOVE = 1,
+};
+
+template<typename T>
+class data_streamer;
+
+/**
+ * Data streamer. Loads data into a table in batches, grouping rows by partitions and sending each batch directly to
+ * the node that holds the primary replica of the partition.
+ *
+ * Rows are buffered per partition. A batch is sent when it reaches the configured page size, on auto flush and on
+ * explicit flush. The order of operations is preserved within a partition.
+ *
+ * A streamer must be closed once all the data is added. Rows which were not sent yet are discarded if the streamer
+ * is destroyed without closing. If a batch can not be sent after all the retries, the streamer fails: every
+ * subsequent operation reports the error.
+ */
+template<>
+class data_streamer<ignite_tuple> {
+    template<typename>
+    friend class record_view;
+
+public:
+    typedef ignite_tuple value_type;
+
+    // Default
+    data_streamer() = default;
+
+    /**
+     * Adds a record to the streamer.
+     *
+     * Blocks while the buffer of the record's partition is full and can not be sent because of the in-flight
+     * batches limit. When called from a callback of an asynchronous operation, throws instead of blocking, as that
+     * could block the completion of the batches. Use flush_async() and continue adding from its callback then.
+     *
+     * @param record Record. For the @c REMOVE operation only key columns are required.
+     * @param op Operation type.
+     */
+    IGNITE_API void add(const value_type &record, data_streamer_operation_type op = data_streamer_operation_type::PUT);
+
+    /**
+     * Sends all the buffered records asynchronously.
+     *
+     * @param callback Callback that is called when all the records added before the call are sent to the cluster.
+     */
+    IGNITE_API void flush_async(ignite_callback<void> callback);
+
+    /**
+     * Sends all the buffered records.
+     */
+    IGNITE_API void flush() {
+        return sync<void>([this](auto callback) mutable { flush_async(std::move(callback)); });
+    }
+
+    /**
+     * Sends all the buffered records and closes the streamer asynchronously. No records can be added after that.
+     *
+     * @param callback Callback that is called when all the records are sent to the cluster.
+     */
+    IGNITE_API void close_async(ignite_callback<void> callback);
+
+    /**
+     * Sends all the buffered records and closes the streamer. No records can be added after that.
+     */
+    IGNITE_API void close() {
+        return sync<void>([this](auto callback) mutable { close_async(std::move(callback)); });
+    }
+
+private:
+    /**
+     * Constructor
+     *
+     * @param impl Implementation
+     */
+    explicit data_streamer(std::shared_ptr<detail::data_streamer_impl> impl)
+        : m_impl(std::move(impl)) {}
+
+    /** Implementation. */
+    std::shared_ptr<detail::data_streamer_impl> m_impl;
+};
+
+/**
+ * Data streamer for the mapped type. See data_streamer<ignite_tuple> for details.
+ */
+template<typename T>
+class data_streamer {
+    template<typename>
+    friend class record_view;
+
+public:
+    typedef typename std::decay<T>::type value_type;
+
+    // Default
+    data_streamer() = default;
+
+    /**
+     * Adds a record to the streamer.
+     *
+     * Blocks while the buffer of the record's partition is full and can not be sent because of the in-flight
+     * batches limit. When called from a callback of an asynchronous operation, throws instead of blocking, as that
+     * could block the completion of the batches. Use flush_async() and continue adding from its callback then.
+     *
+     * @param record Record.
+     * @param op Operation type.
+     */
+    void add(const value_type &record, data_streamer_operation_type op = data_streamer_operation_type::PUT) {
+        m_delegate.add(convert_to_tuple(record), op);
+    }
+
+    /**
+     * Sends all the buffered records asynchronously.
+     *
+     * @param callback Callback that is called when all the records added before the call are sent to the cluster.
+     */
+    void flush_async(ignite_callback<void> callback) { m_delegate.flush_async(std::move(callback)); }
+
+    /**
+     * Sends all the buffered records.
+     */
+    void flush() { m_delegate.flush(); }
+
+    /**
+     * Sends all the buffered records and closes the streamer asynchronously. No records can be added after that.
+     *
+     * @param callback Callback that is called when all the records are sent to the cluster.
+     */
+    void close_async(ignite_callback<void> callback) { m_delegate.close_async(std::move(callback)); }
+
+    /**
+     * Sends all the buffered records and closes the streamer. No records can be added after that.
+     */
+    void close() { m_delegate.close(); }
+
+private:
+    /**
+     * Constructor
+     *
+     * @param delegate Delegate.
+     */
+    explicit data_streamer(data_streamer<ignite_tuple> delegate)
+        : m_delegate(std::move(delegate)) {}
+
+    /** Delegate. */
+    data_streamer<ignite_tuple> m_delegate;
+};
+
+} // namespace ignite
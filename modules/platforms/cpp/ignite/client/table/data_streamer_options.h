@@ -0,0 +1,124 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace ignite {
+
+/**
+ * Data streamer options.
+ */
+class data_streamer_options {
+public:
+    /** Default page size. */
+    static constexpr std::int32_t DEFAULT_PAGE_SIZE = 1000;
+
+    /** Default number of parallel operations per node. */
+    static constexpr std::int32_t DEFAULT_PER_NODE_PARALLEL_OPERATIONS = 4;
+
+    /** Default auto flush interval. */
+    static constexpr std::chrono::milliseconds DEFAULT_AUTO_FLUSH_INTERVAL{5000};
+
+    /** Default retry limit. */
+    static constexpr std::int32_t DEFAULT_RETRY_LIMIT = 16;
+
+    /**
+     * Default constructor.
+     *
+     * Default options:
+     * page_size = 1000;
+     * per_node_parallel_operations = 4;
+     * auto_flush_interval = 5000ms;
+     * retry_limit = 16;
+     */
+    data_streamer_options() = default;
+
+    /**
+     * Gets the number of rows sent to a partition in a single batch.
+     *
+     * @return Page size.
+     */
+    [[nodiscard]] std::int32_t get_page_size() const { return m_page_size; }
+
+    /**
+     * Sets the number of rows sent to a partition in a single batch. A batch is sent as soon as it is full.
+     *
+     * @param page_size Page size. Must be positive.
+     */
+    void set_page_size(std::int32_t page_size) { m_page_size = page_size; }
+
+    /**
+     * Gets the max number of batches that can be sent to a single node concurrently.
+     *
+     * @return Max number of parallel operations per node.
+     */
+    [[nodiscard]] std::int32_t get_per_node_parallel_operations() const { return m_per_node_parallel_operations; }
+
+    /**
+     * Sets the max number of batches that can be sent to a single node concurrently. When the limit is reached,
+     * full batches are held back until the node acknowledges some of the previous ones.
+     *
+     * @param value Max number of parallel operations per node. Must be positive.
+     */
+    void set_per_node_parallel_operations(std::int32_t value) { m_per_node_parallel_operations = value; }
+
+    /**
+     * Gets the auto flush interval.
+     *
+     * @return Auto flush interval.
+     */
+    [[nodiscard]] std::chrono::milliseconds get_auto_flush_interval() const { return m_auto_flush_interval; }
+
+    /**
+     * Sets the auto flush interval. Incomplete batches are sent when this interval passes.
+     *
+     * @param interval Auto flush interval. Must be positive.
+     */
+    void set_auto_flush_interval(std::chrono::milliseconds interval) { m_auto_flush_interval = interval; }
+
+    /**
+     * Gets the max number of times a failed batch is re-sent.
+     *
+     * @return Retry limit.
+     */
+    [[nodiscard]] std::int32_t get_retry_limit() const { return m_retry_limit; }
+
+    /**
+     * Sets the max number of times a failed batch is re-sent, 0 to not retry.
+     *
+     * @param retry_limit Retry limit. Must not be negative.
+     */
+    void set_retry_limit(std::int32_t retry_limit) { m_retry_limit = retry_limit; }
+
+private:
+    /** Page size. */
+    std::int32_t m_page_size{DEFAULT_PAGE_SIZE};
+
+    /** Parallel operations per node. */
+    std::int32_t m_per_node_parallel_operations{DEFAULT_PER_NODE_PARALLEL_OPERATIONS};
+
+    /** Auto flush interval. */
+    std::chrono::milliseconds m_auto_flush_interval{DEFAULT_AUTO_FLUSH_INTERVAL};
+
+    /** Retry limit. */
+    std::int32_t m_retry_limit{DEFAULT_RETRY_LIMIT};
+};
+
+} // namespace ignite
@@ -17,6 +17,7 @@
 
 #include "ignite/client/table/record_view.h"
 #include "ignite/client/detail/argument_check_utils.h"
+#include "ignite/client/detail/table/data_streamer_impl.h"
 #include "ignite/client/detail/table/table_impl.h"
 
 namespace ignite {
@@ -141,4 +142,31 @@ void record_view<ignite_tuple>::remove_all_exact_async(
     m_impl->remove_all_exact_async(tx, std::move(records), std::move(callback));
 }
 
+void record_view<ignite_tuple>::create_data_streamer_async(
+    data_streamer_options options, ignite_callback<data_streamer<value_type>> callback) {
+    detail::data_streamer_impl::create_async(m_impl, options, [callback = std::move(callback)](auto &&res) {
+        if (res.has_error()) {
+            callback(std::move(res).error());
+            return;
+        }
+
+        callback(data_streamer<value_type>(std::move(res).value()));
+    });
+}
+
+void record_view<ignite_tuple>::stream_data_async(std::function<std::optional<value_type>()> source,
+    data_streamer_options options, ignite_callback<void> callback) {
+    detail::arg_check::pointer_valid(source, "Source");
+
+    detail::data_streamer_impl::create_async(
+        m_impl, options, [source = std::move(source), callback = std::move(callback)](auto &&res) mutable {
+            if (res.has_error()) {
+                callback(std::move(res).error());
+                return;
+            }
+
+            res.value()->stream_async(std::move(source), std::move(callback));
+        });
+}
+
 } // namespace ignite
@@ -18,6 +18,8 @@
 #pragma once
 
 #include <ignite/client/detail/type_mapping_utils.h>
+#include <ignite/client/table/data_streamer.h>
+#include <ignite/client/table/data_streamer_options.h>
 #include <ignite/client/table/ignite_tuple.h>
 #include <ignite/client/transaction/transaction.h>
 #include <ignite/client/type_mapping.h>
@@ -25,7 +27,9 @@
 #include "ignite/common/detail/config.h"
 #include <ignite/common/ignite_result.h>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -449,6 +453,52 @@ public:
         });
     }
 
+    /**
+     * Creates a data streamer for the table asynchronously.
+     *
+     * @param options Streamer options.
+     * @param callback Callback that is called with the new streamer.
+     */
+    IGNITE_API void create_data_streamer_async(
+        data_streamer_options options, ignite_callback<data_streamer<value_type>> callback);
+
+    /**
+     * Creates a data streamer for the table.
+     *
+     * @param options Streamer options.
+     * @return New streamer.
+     */
+    [[nodiscard]] IGNITE_API data_streamer<value_type> create_data_streamer(data_streamer_options options = {}) {
+        return sync<data_streamer<value_type>>(
+            [this, &options](auto callback) { create_data_streamer_async(options, std::move(callback)); });
+    }
+
+    /**
+     * Streams data from the source into the table asynchronously.
+     *
+     * The source is pulled only while the streamer buffers have room for new records. It is called both from the
+     * calling thread and from the client's internal threads, so it must not block. All the records are put into the
+     * table, replacing the existing ones.
+     *
+     * @param source Source of records. Returns @c std::nullopt when there are no more records.
+     * @param options Streamer options.
+     * @param callback Callback that is called when all the records are sent to the cluster.
+     */
+    IGNITE_API void stream_data_async(std::function<std::optional<value_type>()> source,
+        data_streamer_options options, ignite_callback<void> callback);
+
+    /**
+     * Streams data from the source into the table.
+     *
+     * @param source Source of records. Returns @c std::nullopt when there are no more records.
+     * @param options Streamer options.
+     */
+    IGNITE_API void stream_data(std::function<std::optional<value_type>()> source, data_streamer_options options = {}) {
+        sync<void>([this, source = std::move(source), &options](auto callback) mutable {
+            stream_data_async(std::move(source), options, std::move(callback));
+        });
+    }
+
 private:
     /**
      * Constructor
@@ -906,6 +956,71 @@ public:
         });
     }
 
+    /**
+     * Creates a data streamer for the table asynchronously.
+     *
+     * @param options Streamer options.
+     * @param callback Callback that is called with the new streamer.
+     */
+    void create_data_streamer_async(
+        data_streamer_options options, ignite_callback<data_streamer<value_type>> callback) {
+        m_delegate.create_data_streamer_async(std::move(options), [callback = std::move(callback)](auto &&res) {
+            if (res.has_error()) {
+                callback(std::move(res).error());
+                return;
+            }
+
+            callback(data_streamer<value_type>(std::move(res).value()));
+        });
+    }
+
+    /**
+     * Creates a data streamer for the table.
+     *
+     * @param options Streamer options.
+     * @return New streamer.
+     */
+    [[nodiscard]] data_streamer<value_type> create_data_streamer(data_streamer_options options = {}) {
+        return sync<data_streamer<value_type>>(
+            [this, &options](auto callback) { create_data_streamer_async(options, std::move(callback)); });
+    }
+
+    /**
+     * Streams data from the source into the table asynchronously.
+     *
+     * The source is pulled only while the streamer buffers have room for new records. It is called both from the
+     * calling thread and from the client's internal threads, so it must not block. All the records are put into the
+     * table, replacing the existing ones.
+     *
+     * @param source Source of records. Returns @c std::nullopt when there are no more records.
+     * @param options Streamer options.
+     * @param callback Callback that is called when all the records are sent to the cluster.
+     */
+    void stream_data_async(std::function<std::optional<value_type>()> source, data_streamer_options options,
+        ignite_callback<void> callback) {
+        auto tuple_source = [source = std::move(source)]() -> std::optional<ignite_tuple> {
+            auto value = source();
+            if (!value)
+                return std::nullopt;
+
+            return convert_to_tuple(std::move(*value));
+        };
+
+        m_delegate.stream_data_async(std::move(tuple_source), std::move(options), std::move(callback));
+    }
+
+    /**
+     * Streams data from the source into the table.
+     *
+     * @param source Source of records. Returns @c std::nullopt when there are no more records.
+     * @param options Streamer options.
+     */
+    void stream_data(std::function<std::optional<value_type>()> source, data_streamer_options options = {}) {
+        sync<void>([this, source = std::move(source), &options](auto callback) mutable {
+            stream_data_async(std::move(source), options, std::move(callback));
+        });
+    }
+
 private:
     /**
      * Constructor
@@ -41,8 +41,10 @@ big_decimal::big_decimal(const std::byte *data, std::size_t size) {
 }
 
 void big_decimal::set_scale(std::int16_t new_scale, big_decimal &res) const {
-    if (m_scale == new_scale)
+    if (m_scale == new_scale) {
+        res = *this;
         return;
+    }
 
     auto diff = std::int16_t(m_scale - new_scale);
 
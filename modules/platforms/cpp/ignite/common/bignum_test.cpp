@@ -939,6 +939,18 @@ TEST(bignum, TestScalingSmall) {
     EXPECT_EQ(decimal.to_int64(), 123);
 }
 
+TEST(bignum, TestScalingSame) {
+    big_decimal decimal(12345, 2);
+
+    big_decimal scaled;
+    decimal.set_scale(2, scaled);
+
+    EXPECT_EQ(decimal, scaled);
+    EXPECT_EQ(scaled.get_scale(), 2);
+
+    EXPECT_EQ(big_decimal(123, 0).to_int64(), 123);
+}
+
 TEST(bignum, TestScalingBig) {
     big_integer big_int(69213205262741);
 
@@ -0,0 +1,113 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "buffer_pool.h"
+
+#include <algorithm>
+
+namespace {
+
+/**
+ * Get the position of the highest set bit.
+ *
+ * @param value Value. Must be positive.
+ * @return Bit position.
+ */
+std::size_t floor_log2(std::size_t value) {
+    std::size_t res = 0;
+    while (value >>= 1)
+        ++res;
+
+    return res;
+}
+
+/**
+ * Get the maximum number of free buffers kept for the size class.
+ *
+ * @param shift Size class as a power of two.
+ * @return Maximum number of buffers.
+ */
+std::size_t max_free_buffers(std::size_t shift) {
+    using ignite::detail::buffer_pool;
+
+    return std::clamp(buffer_pool::MAX_CLASS_BYTES >> shift, std::size_t(4), buffer_pool::MAX_CLASS_BUFFERS);
+}
+
+} // namespace
+
+namespace ignite::detail {
+
+buffer_pool &buffer_pool::get_default() {
+    static buffer_pool pool;
+
+    return pool;
+}
+
+std::vector<std::byte> buffer_pool::lease(std::size_t size) {
+    std::vector<std::byte> res;
+    if (size > MAX_CLASS_SIZE) {
+        res.reserve(size);
+        return res;
+    }
+
+    // Round up, so any buffer of the class fits the data.
+    auto shift = std::max(floor_log2(std::max(size, std::size_t(1)) * 2 - 1), MIN_CLASS_SHIFT);
+    auto &cls = m_classes[shift - MIN_CLASS_SHIFT];
+    {
+        std::lock_guard<std::mutex> lock(cls.mutex);
+
+        if (!cls.buffers.empty()) {
+            res = std::move(cls.buffers.back());
+            cls.buffers.pop_back();
+            return res;
+        }
+    }
+
+    res.reserve(std::size_t(1) << shift);
+    return res;
+}
+
+void buffer_pool::release(std::vector<std::byte> &&buffer) {
+    auto capacity = buffer.capacity();
+    if (capacity < MIN_CLASS_SIZE)
+        return;
+
+    // Round down, so the buffer fits any lease of the class.
+    auto shift = floor_log2(capacity);
+    if (shift > MAX_CLASS_SHIFT)
+        return;
+
+    auto &cls = m_classes[shift - MIN_CLASS_SHIFT];
+
+    buffer.clear();
+
+    std::lock_guard<std::mutex> lock(cls.mutex);
+    if (cls.buffers.size() < max_free_buffers(shift))
+        cls.buffers.push_back(std::move(buffer));
+}
+
+std::size_t buffer_pool::free_buffers() const {
+    std::size_t res = 0;
+    for (auto &cls : m_classes) {
+        std::lock_guard<std::mutex> lock(cls.mutex);
+        res += cls.buffers.size();
+    }
+
+    return res;
+}
+
+} // namespace ignite::detail
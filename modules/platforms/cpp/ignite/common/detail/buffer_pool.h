@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Pool of byte buffers with power-of-two size classes.
+ *
+ * Leased buffers are empty and have at least the requested capacity. Released buffers are kept in the free list of
+ * the largest class not exceeding their capacity, so they can be reused for the next lease of that class. Buffers
+ * smaller than the smallest class, larger than the largest class or released to a full free list are freed.
+ * Thread-safe.
+ */
+class buffer_pool {
+public:
+    /** Smallest size class as a power of two. */
+    static constexpr std::size_t MIN_CLASS_SHIFT = 8;
+
+    /** Largest size class as a power of two. */
+    static constexpr std::size_t MAX_CLASS_SHIFT = 20;
+
+    /** Number of size classes. */
+    static constexpr std::size_t CLASS_COUNT = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+
+    /** Smallest size class. */
+    static constexpr std::size_t MIN_CLASS_SIZE = std::size_t(1) << MIN_CLASS_SHIFT;
+
+    /** Largest size class. */
+    static constexpr std::size_t MAX_CLASS_SIZE = std::size_t(1) << MAX_CLASS_SHIFT;
+
+    /** Total size of the buffers kept in the free list of a single class. */
+    static constexpr std::size_t MAX_CLASS_BYTES = std::size_t(4) << 20;
+
+    /** Maximum number of buffers kept in the free list of a single class. */
+    static constexpr std::size_t MAX_CLASS_BUFFERS = 256;
+
+    /**
+     * Get the process-wide pool.
+     *
+     * @return Pool.
+     */
+    static buffer_pool &get_default();
+
+    /**
+     * Lease a buffer.
+     *
+     * @param size Expected size of the data.
+     * @return Empty buffer with at least the requested capacity.
+     */
+    [[nodiscard]] std::vector<std::byte> lease(std::size_t size);
+
+    /**
+     * Return a buffer to the pool.
+     *
+     * @param buffer Buffer. Does not have to be leased from this pool.
+     */
+    void release(std::vector<std::byte> &&buffer);
+
+    /**
+     * Get the number of buffers kept in the free lists.
+     *
+     * @return Number of free buffers.
+     */
+    [[nodiscard]] std::size_t free_buffers() const;
+
+private:
+    /** Size class. */
+    struct size_class {
+        /** Free list mutex. */
+        mutable std::mutex mutex;
+
+        /** Free buffers. */
+        std::vector<std::vector<std::byte>> buffers;
+    };
+
+    /** Size classes. */
+    std::array<size_class, CLASS_COUNT> m_classes;
+};
+
+} // namespace ignite::detail
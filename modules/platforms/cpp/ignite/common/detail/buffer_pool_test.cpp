@@ -0,0 +1,129 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace ignite::detail;
+
+TEST(buffer_pool, lease_rounds_up_to_size_class) {
+    buffer_pool pool;
+
+    auto small = pool.lease(1);
+    EXPECT_TRUE(small.empty());
+    EXPECT_GE(small.capacity(), buffer_pool::MIN_CLASS_SIZE);
+
+    auto medium = pool.lease(1000);
+    EXPECT_TRUE(medium.empty());
+    EXPECT_GE(medium.capacity(), 1024);
+
+    auto exact = pool.lease(4096);
+    EXPECT_GE(exact.capacity(), 4096);
+
+    auto huge = pool.lease(buffer_pool::MAX_CLASS_SIZE + 1);
+    EXPECT_GE(huge.capacity(), buffer_pool::MAX_CLASS_SIZE + 1);
+}
+
+TEST(buffer_pool, released_buffer_is_reused) {
+    buffer_pool pool;
+
+    auto buf = pool.lease(1000);
+    buf.resize(1000, std::byte{42});
+    auto data = buf.data();
+
+    pool.release(std::move(buf));
+    EXPECT_EQ(1, pool.free_buffers());
+
+    auto buf2 = pool.lease(600);
+    EXPECT_EQ(0, pool.free_buffers());
+    EXPECT_TRUE(buf2.empty());
+    EXPECT_EQ(data, buf2.data());
+}
+
+TEST(buffer_pool, released_buffer_fits_its_class) {
+    buffer_pool pool;
+
+    // Capacity of 1500 only fits leases of up to 1024 bytes.
+    std::vector<std::byte> buf;
+    buf.reserve(1500);
+    pool.release(std::move(buf));
+    EXPECT_EQ(1, pool.free_buffers());
+
+    auto larger = pool.lease(1025);
+    EXPECT_GE(larger.capacity(), 1025);
+    EXPECT_EQ(1, pool.free_buffers());
+
+    auto smaller = pool.lease(1024);
+    EXPECT_GE(smaller.capacity(), 1024);
+    EXPECT_EQ(0, pool.free_buffers());
+}
+
+TEST(buffer_pool, unsuitable_buffers_are_dropped) {
+    buffer_pool pool;
+
+    std::vector<std::byte> tiny;
+    tiny.reserve(buffer_pool::MIN_CLASS_SIZE - 1);
+    pool.release(std::move(tiny));
+
+    std::vector<std::byte> huge;
+    huge.reserve(buffer_pool::MAX_CLASS_SIZE * 2);
+    pool.release(std::move(huge));
+
+    EXPECT_EQ(0, pool.free_buffers());
+}
+
+TEST(buffer_pool, free_list_is_capped) {
+    buffer_pool pool;
+
+    for (int i = 0; i < 10; ++i)
+        pool.release(pool.lease(buffer_pool::MAX_CLASS_SIZE));
+
+    std::vector<std::vector<std::byte>> leased;
+    for (int i = 0; i < 10; ++i)
+        leased.push_back(pool.lease(buffer_pool::MAX_CLASS_SIZE));
+
+    for (auto &buf : leased)
+        pool.release(std::move(buf));
+
+    EXPECT_EQ(buffer_pool::MAX_CLASS_BYTES / buffer_pool::MAX_CLASS_SIZE, pool.free_buffers());
+}
+
+TEST(buffer_pool, concurrent_lease_and_release) {
+    buffer_pool pool;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&pool, t] {
+            for (std::size_t i = 0; i < 1000; ++i) {
+                auto size = (i * 37 + t) % 5000;
+                auto buf = pool.lease(size);
+                EXPECT_GE(buf.capacity(), size);
+                buf.resize(size);
+                pool.release(std::move(buf));
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_LE(pool.free_buffers(), 4 * buffer_pool::CLASS_COUNT);
+}
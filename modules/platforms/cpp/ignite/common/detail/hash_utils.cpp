@@ -0,0 +1,275 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hash_utils.h"
+#include "bytes.h"
+
+#include "ignite/common/ignite_error.h"
+
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t C1 = 0x87c37b91114253d5ULL;
+constexpr std::uint64_t C2 = 0x4cf5ad432745937fULL;
+constexpr int R1 = 31;
+constexpr int R2 = 27;
+constexpr int R3 = 33;
+constexpr std::uint64_t M = 5;
+constexpr std::uint64_t N1 = 0x52dce729;
+constexpr std::uint64_t N2 = 0x38495ab5;
+
+constexpr std::uint64_t rotl64(std::uint64_t value, int shift) noexcept {
+    return (value << shift) | (value >> (64 - shift));
+}
+
+constexpr std::uint64_t fmix64(std::uint64_t hash) noexcept {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+constexpr std::int32_t fold(std::uint64_t hash) noexcept {
+    return std::int32_t(std::uint32_t(hash ^ (hash >> 32)));
+}
+
+/**
+ * Hash a single value of up to 8 bytes.
+ *
+ * @param data Value bytes, zero-extended to 64 bits.
+ * @param seed Seed.
+ * @param byte_count Number of significant bytes in the value.
+ * @return 64-bit hash.
+ */
+std::uint64_t hash64(std::uint64_t data, std::uint64_t seed, std::uint64_t byte_count) {
+    std::uint64_t h1 = seed;
+    std::uint64_t h2 = seed;
+
+    std::uint64_t k1 = data;
+    k1 *= C1;
+    k1 = rotl64(k1, R1);
+    k1 *= C2;
+    h1 ^= k1;
+
+    h1 ^= byte_count;
+    h2 ^= byte_count;
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+
+    return h1 + h2;
+}
+
+/**
+ * Hash a byte sequence.
+ *
+ * @param data Data.
+ * @param seed Seed.
+ * @return 64-bit hash.
+ */
+std::uint64_t hash64(ignite::bytes_view data, std::uint64_t seed) {
+    using namespace ignite::detail;
+
+    std::uint64_t h1 = seed;
+    std::uint64_t h2 = seed;
+
+    const auto *ptr = data.data();
+    const std::size_t length = data.size();
+    const std::size_t blocks = length >> 4;
+
+    for (std::size_t i = 0; i < blocks; i++) {
+        std::uint64_t k1 = bytes::load<endian::LITTLE, std::uint64_t>(ptr + (i << 4));
+        std::uint64_t k2 = bytes::load<endian::LITTLE, std::uint64_t>(ptr + (i << 4) + 8);
+
+        k1 *= C1;
+        k1 = rotl64(k1, R1);
+        k1 *= C2;
+        h1 ^= k1;
+        h1 = rotl64(h1, R2);
+        h1 += h2;
+        h1 = h1 * M + N1;
+
+        k2 *= C2;
+        k2 = rotl64(k2, R3);
+        k2 *= C1;
+        h2 ^= k2;
+        h2 = rotl64(h2, R1);
+        h2 += h1;
+        h2 = h2 * M + N2;
+    }
+
+    const auto *tail = ptr + (blocks << 4);
+    const std::size_t rest = length - (blocks << 4);
+
+    std::uint64_t k1 = 0;
+    std::uint64_t k2 = 0;
+
+    for (std::size_t i = rest; i > 8; i--)
+        k2 ^= std::uint64_t(tail[i - 1]) << ((i - 9) * 8);
+
+    if (rest > 8) {
+        k2 *= C2;
+        k2 = rotl64(k2, R3);
+        k2 *= C1;
+        h2 ^= k2;
+    }
+
+    for (std::size_t i = std::min(rest, std::size_t(8)); i > 0; i--)
+        k1 ^= std::uint64_t(tail[i - 1]) << ((i - 1) * 8);
+
+    if (rest > 0) {
+        k1 *= C1;
+        k1 = rotl64(k1, R1);
+        k1 *= C2;
+        h1 ^= k1;
+    }
+
+    h1 ^= length;
+    h2 ^= length;
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+
+    return h1 + h2;
+}
+
+/**
+ * Sign-extend a seed the same way Java does when an int seed is passed where a long one is expected.
+ *
+ * @param seed Seed.
+ * @return Extended seed.
+ */
+constexpr std::uint64_t extend_seed(std::int32_t seed) noexcept {
+    return std::uint64_t(std::int64_t(seed));
+}
+
+} // anonymous namespace
+
+namespace ignite::detail {
+
+std::int32_t hash32(std::int8_t data) {
+    return fold(hash64(std::uint8_t(data), 0, 1));
+}
+
+std::int32_t hash32(std::int16_t data) {
+    return fold(hash64(std::uint16_t(data), 0, 2));
+}
+
+std::int32_t hash32(std::int32_t data, std::int32_t seed) {
+    return fold(hash64(std::uint32_t(data), extend_seed(seed), 4));
+}
+
+std::int32_t hash32(std::int64_t data, std::int32_t seed) {
+    return fold(hash64(std::uint64_t(data), extend_seed(seed), 8));
+}
+
+std::int32_t hash32(float data) {
+    return hash32(bytes::cast<std::int32_t>(data));
+}
+
+std::int32_t hash32(double data) {
+    return hash32(bytes::cast<std::int64_t>(data));
+}
+
+std::int32_t hash32(bytes_view data) {
+    if (data.empty())
+        return 0;
+
+    return fold(hash64(data, 0));
+}
+
+std::int32_t hash32(const uuid &data) {
+    return hash32(data.get_least_significant_bits(), hash32(data.get_most_significant_bits()));
+}
+
+std::int32_t hash32(const big_decimal &data, std::int16_t scale) {
+    big_decimal scaled{data};
+    data.set_scale(scale, scaled);
+
+    const auto &unscaled = scaled.get_unscaled_value();
+
+    std::vector<std::byte> bytes(unscaled.byte_size());
+    unscaled.store_bytes(bytes.data());
+
+    return hash32(bytes_view{bytes});
+}
+
+std::int32_t hash32(const ignite_date &data) {
+    return hash32(
+        std::int32_t(data.get_day_of_month()), hash32(std::int32_t(data.get_month()), hash32(data.get_year())));
+}
+
+std::int32_t hash32(const ignite_time &data, std::int32_t precision) {
+    auto nanos = normalize_nanos(data.get_nano(), precision);
+
+    return hash32(nanos,
+        hash32(std::int32_t(data.get_second()),
+            hash32(std::int32_t(data.get_minute()), hash32(std::int32_t(data.get_hour())))));
+}
+
+std::int32_t hash32(const ignite_date_time &data, std::int32_t precision) {
+    return hash_combine(hash32(data.date()), hash32(data.time(), precision));
+}
+
+std::int32_t hash32(const ignite_timestamp &data, std::int32_t precision) {
+    auto nanos = normalize_nanos(data.get_nano(), precision);
+
+    return hash32(nanos, hash32(data.get_epoch_second()));
+}
+
+std::int32_t hash_combine(std::int32_t hash1, std::int32_t hash2) {
+    return hash32(hash1, hash2);
+}
+
+std::int32_t normalize_nanos(std::int32_t nanos, std::int32_t precision) {
+    switch (precision) {
+        case 0:
+            return 0;
+        case 1:
+            return (nanos / 100'000'000) * 100'000'000;
+        case 2:
+            return (nanos / 10'000'000) * 10'000'000;
+        case 3:
+            return (nanos / 1'000'000) * 1'000'000;
+        case 4:
+            return (nanos / 100'000) * 100'000;
+        case 5:
+            return (nanos / 10'000) * 10'000;
+        case 6:
+            return (nanos / 1'000) * 1'000;
+        case 7:
+            return (nanos / 100) * 100;
+        case 8:
+            return (nanos / 10) * 10;
+        case 9:
+            return nanos;
+        default:
+            throw ignite_error("Unsupported fractional seconds precision: " + std::to_string(precision));
+    }
+}
+
+} // namespace ignite::detail
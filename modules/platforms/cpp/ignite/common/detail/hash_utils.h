@@ -0,0 +1,203 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ignite/common/big_decimal.h"
+#include "ignite/common/bytes_view.h"
+#include "ignite/common/ignite_date.h"
+#include "ignite/common/ignite_date_time.h"
+#include "ignite/common/ignite_time.h"
+#include "ignite/common/ignite_timestamp.h"
+#include "ignite/common/uuid.h"
+
+#include <cstdint>
+
+/**
+ * Hash functions based on MurmurHash3.
+ *
+ * Must produce exactly the same values as org.apache.ignite.internal.util.HashUtils and
+ * org.apache.ignite.internal.util.HashCalculator on the server side, as the values are used to find the partition
+ * that a key belongs to.
+ */
+namespace ignite::detail {
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(std::int8_t data);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(std::int16_t data);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @param seed Seed.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(std::int32_t data, std::int32_t seed = 0);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @param seed Seed.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(std::int64_t data, std::int32_t seed = 0);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(float data);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(double data);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @return Resulting hash. Zero for an empty input.
+ */
+std::int32_t hash32(bytes_view data);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(const uuid &data);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @param scale Column scale. The value is rescaled before hashing.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(const big_decimal &data, std::int16_t scale);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(const ignite_date &data);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @param precision Column precision. Nanoseconds are truncated to this precision before hashing.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(const ignite_time &data, std::int32_t precision);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @param precision Column precision. Nanoseconds are truncated to this precision before hashing.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(const ignite_date_time &data, std::int32_t precision);
+
+/**
+ * Generate 32-bit hash.
+ *
+ * @param data Input data.
+ * @param precision Column precision. Nanoseconds are truncated to this precision before hashing.
+ * @return Resulting hash.
+ */
+std::int32_t hash32(const ignite_timestamp &data, std::int32_t precision);
+
+/**
+ * Combine two hashes.
+ *
+ * @param hash1 Hash 1.
+ * @param hash2 Hash 2.
+ * @return Combined hash.
+ */
+std::int32_t hash_combine(std::int32_t hash1, std::int32_t hash2);
+
+/**
+ * Truncate nanoseconds to the specified fractional seconds precision.
+ *
+ * @param nanos Nanoseconds.
+ * @param precision Precision, from 0 to 9.
+ * @return Normalized nanoseconds.
+ */
+std::int32_t normalize_nanos(std::int32_t nanos, std::int32_t precision);
+
+/**
+ * Hash calculator.
+ *
+ * Accumulates hashes of several values (e.g. colocation columns of a row) into a single one.
+ */
+class hash_calculator {
+public:
+    /**
+     * Append null value.
+     */
+    void append_null() { append_hash(hash32(std::int8_t(0))); }
+
+    /**
+     * Append a hash of a value.
+     *
+     * @param hash Hash of the value.
+     */
+    void append_hash(std::int32_t hash) { m_hash = hash_combine(m_hash, hash); }
+
+    /**
+     * Get the resulting hash.
+     *
+     * @return Resulting hash.
+     */
+    [[nodiscard]] std::int32_t get_hash() const noexcept { return m_hash; }
+
+    /**
+     * Reset the calculator.
+     */
+    void reset() noexcept { m_hash = 0; }
+
+private:
+    /** Accumulated hash. */
+    std::int32_t m_hash{0};
+};
+
+} // namespace ignite::detail
@@ -0,0 +1,123 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hash_utils.h"
+
+#include "ignite/common/ignite_error.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+
+using namespace ignite;
+using namespace ignite::detail;
+
+// Expected values are the results of the Java implementation (org.apache.ignite.internal.util.HashUtils).
+
+TEST(hash_utils, integers) {
+    EXPECT_EQ(686815056, hash32(std::int8_t(0)));
+    EXPECT_EQ(-105209210, hash32(std::int8_t(1)));
+    EXPECT_EQ(-482826348, hash32(std::int8_t(-1)));
+    EXPECT_EQ(-2036967051, hash32(std::int8_t(127)));
+
+    EXPECT_EQ(22229479, hash32(std::int16_t(-1)));
+    EXPECT_EQ(-607177218, hash32(std::int16_t(12345)));
+
+    EXPECT_EQ(401375585, hash32(std::int32_t(0)));
+    EXPECT_EQ(666724619, hash32(std::int32_t(1)));
+    EXPECT_EQ(2008810410, hash32(std::int32_t(-1)));
+    EXPECT_EQ(-1452754491, hash32(std::numeric_limits<std::int32_t>::max()));
+    EXPECT_EQ(-1060557553, hash32(std::int32_t(42), -100));
+
+    EXPECT_EQ(-460808068, hash32(std::int64_t(0)));
+    EXPECT_EQ(-1168220407, hash32(std::int64_t(-1)));
+    EXPECT_EQ(-1253265447, hash32(std::numeric_limits<std::int64_t>::min()));
+    EXPECT_EQ(-756311661, hash32(std::int64_t(1234567890123), 7));
+}
+
+TEST(hash_utils, floating_point) {
+    EXPECT_EQ(186468581, hash32(1.5f));
+    EXPECT_EQ(-1660123730, hash32(-2.25));
+}
+
+TEST(hash_utils, combine) {
+    EXPECT_EQ(408568777, hash_combine(1, 2));
+    EXPECT_EQ(26223551, hash_combine(-5, 100500));
+}
+
+TEST(hash_utils, bytes) {
+    EXPECT_EQ(0, hash32(bytes_view{}));
+    EXPECT_EQ(1930178028, hash32(bytes_view{std::string("a")}));
+    EXPECT_EQ(-66796365, hash32(bytes_view{std::string("Hello, World!")}));
+    EXPECT_EQ(-2069185485, hash32(bytes_view{std::string("0123456789abcdef")}));
+    EXPECT_EQ(1598859031, hash32(bytes_view{std::string("The quick brown fox jumps over the lazy dog")}));
+    EXPECT_EQ(1300815179, hash32(bytes_view{std::string("\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82")}));
+
+    // A single byte is hashed the same way as int8.
+    std::byte zero{0};
+    EXPECT_EQ(hash32(std::int8_t(0)), hash32(bytes_view{&zero, 1}));
+}
+
+TEST(hash_utils, uuid) {
+    EXPECT_EQ(-2120767834, hash32(uuid(0x123e4567e89b12d3LL, std::int64_t(0xa456426614174000ULL))));
+}
+
+TEST(hash_utils, decimal) {
+    EXPECT_EQ(686815056, hash32(big_decimal(0), 0));
+    EXPECT_EQ(-875335878, hash32(big_decimal("123.45"), 2));
+    EXPECT_EQ(-875335878, hash32(big_decimal("123.456"), 2));
+    EXPECT_EQ(296227175, hash32(big_decimal("-123.45"), 2));
+    EXPECT_EQ(2058358673, hash32(big_decimal("123456789012345678901234567890"), 0));
+}
+
+TEST(hash_utils, temporal) {
+    EXPECT_EQ(1877002737, hash32(ignite_date(2022, 1, 27)));
+    EXPECT_EQ(-1454998425, hash32(ignite_date(-1, 12, 31)));
+
+    EXPECT_EQ(-1392739273, hash32(ignite_time(11, 33, 44, 123456), 9));
+    EXPECT_EQ(1802740999, hash32(ignite_time(11, 33, 44, 123456), 3));
+    EXPECT_EQ(1802740999, hash32(ignite_time(11, 33, 44, 123456), 0));
+
+    ignite_date_time date_time{ignite_date(2022, 1, 27), ignite_time(1, 2, 3, 999)};
+    EXPECT_EQ(-1145029447, hash32(date_time, 9));
+    EXPECT_EQ(-594132699, hash32(date_time, 6));
+
+    EXPECT_EQ(-153794529, hash32(ignite_timestamp(1700000000, 123456789), 6));
+    EXPECT_EQ(1028608660, hash32(ignite_timestamp(-2, 500000000), 9));
+}
+
+TEST(hash_utils, normalize_nanos) {
+    EXPECT_EQ(0, normalize_nanos(123456789, 0));
+    EXPECT_EQ(100000000, normalize_nanos(123456789, 1));
+    EXPECT_EQ(123000000, normalize_nanos(123456789, 3));
+    EXPECT_EQ(123456000, normalize_nanos(123456789, 6));
+    EXPECT_EQ(123456789, normalize_nanos(123456789, 9));
+    EXPECT_THROW(normalize_nanos(1, 10), ignite_error);
+}
+
+TEST(hash_utils, calculator) {
+    hash_calculator calc;
+    EXPECT_EQ(0, calc.get_hash());
+
+    calc.append_hash(hash32(std::int32_t(1)));
+    calc.append_null();
+    EXPECT_EQ(hash_combine(hash_combine(0, hash32(std::int32_t(1))), hash32(std::int8_t(0))), calc.get_hash());
+
+    calc.reset();
+    EXPECT_EQ(0, calc.get_hash());
+}
@@ -0,0 +1,197 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ignite::detail {
+
+/**
+ * Hashed timer wheel.
+ *
+ * Deadlines are rounded up to the wheel resolution and hashed into a fixed number of slots, so adding a timer is
+ * O(1) and expiring is proportional to the number of timers in the passed slots. Timers that are more than a full
+ * revolution ahead stay in their slot until their round comes. Not thread-safe.
+ *
+ * @tparam T Timer value type.
+ */
+template<typename T>
+class timer_wheel {
+public:
+    /** Clock. */
+    typedef std::chrono::steady_clock clock;
+
+    /**
+     * Constructor.
+     *
+     * @param resolution Resolution. Must be positive.
+     * @param slots Number of slots. Must be positive.
+     * @param start Start time.
+     */
+    timer_wheel(std::chrono::milliseconds resolution, std::size_t slots, clock::time_point start = clock::now())
+        : m_resolution(resolution)
+        , m_start(start)
+        , m_slots(slots) {}
+
+    /**
+     * Add a timer.
+     *
+     * @param deadline Deadline. A timer with a deadline in the past expires on the next tick.
+     * @param value Value.
+     * @return Tick the timer expires at. Is used to cancel the timer.
+     */
+    std::int64_t add(clock::time_point deadline, T value) {
+        auto tick = std::max(to_tick(deadline, true), m_current_tick + 1);
+        m_slots[std::size_t(tick) % m_slots.size()].push_back({tick, std::move(value)});
+        ++m_size;
+
+        return tick;
+    }
+
+    /**
+     * Cancel a timer which did not expire yet.
+     *
+     * Only the slot of the timer is searched, so cancelling is proportional to the number of timers in the slot.
+     *
+     * @param tick Tick returned by add() for the timer.
+     * @param value Value of the timer. If several timers of the tick have equal values, one of them is cancelled.
+     * @return @c true if the timer was found and cancelled.
+     */
+    bool cancel(std::int64_t tick, const T &value) {
+        if (tick <= m_current_tick)
+            return false;
+
+        auto &slot = m_slots[std::size_t(tick) % m_slots.size()];
+        auto it = std::find_if(
+            slot.begin(), slot.end(), [&](const entry &e) { return e.tick == tick && e.value == value; });
+
+        if (it == slot.end())
+            return false;
+
+        // The order of timers in a slot does not matter.
+        if (it != slot.end() - 1)
+            *it = std::move(slot.back());
+
+        slot.pop_back();
+        --m_size;
+
+        return true;
+    }
+
+    /**
+     * Expire all the timers with deadlines before or at the specified time.
+     *
+     * @param now Current time.
+     * @param func Function to call with the value of each expired timer.
+     */
+    template<typename F>
+    void expire(clock::time_point now, F func) {
+        auto target = to_tick(now, false);
+        if (target <= m_current_tick)
+            return;
+
+        auto last = std::min(target, m_current_tick + std::int64_t(m_slots.size()));
+        for (auto tick = m_current_tick + 1; tick <= last; ++tick) {
+            auto &slot = m_slots[std::size_t(tick) % m_slots.size()];
+
+            auto it = std::partition(slot.begin(), slot.end(), [target](const entry &e) { return e.tick > target; });
+            for (auto expired = it; expired != slot.end(); ++expired)
+                func(std::move(expired->value));
+
+            m_size -= std::size_t(slot.end() - it);
+            slot.erase(it, slot.end());
+        }
+
+        m_current_tick = target;
+    }
+
+    /**
+     * Remove all the timers.
+     *
+     * @param func Function to call with the value of each removed timer.
+     */
+    template<typename F>
+    void clear(F func) {
+        for (auto &slot : m_slots) {
+            for (auto &e : slot)
+                func(std::move(e.value));
+
+            slot.clear();
+        }
+
+        m_size = 0;
+    }
+
+    /**
+     * Get the number of timers.
+     *
+     * @return Number of timers.
+     */
+    [[nodiscard]] std::size_t size() const { return m_size; }
+
+private:
+    /**
+     * Timer entry.
+     */
+    struct entry {
+        /** Tick the timer expires at. */
+        std::int64_t tick;
+
+        /** Value. */
+        T value;
+    };
+
+    /**
+     * Convert time to the number of ticks since the start.
+     *
+     * @param time Time.
+     * @param round_up Whether to round up or down.
+     * @return Tick.
+     */
+    [[nodiscard]] std::int64_t to_tick(clock::time_point time, bool round_up) const {
+        auto res = m_resolution.count();
+        if (round_up) {
+            auto ms = std::chrono::ceil<std::chrono::milliseconds>(time - m_start).count();
+            return ms <= 0 ? 0 : (ms + res - 1) / res;
+        }
+
+        auto ms = std::chrono::floor<std::chrono::milliseconds>(time - m_start).count();
+        return ms <= 0 ? 0 : ms / res;
+    }
+
+    /** Resolution. */
+    const std::chrono::milliseconds m_resolution;
+
+    /** Start time. */
+    const clock::time_point m_start;
+
+    /** Slots. */
+    std::vector<std::vector<entry>> m_slots;
+
+    /** Last processed tick. */
+    std::int64_t m_current_tick{0};
+
+    /** Number of timers. */
+    std::size_t m_size{0};
+};
+
+} // namespace ignite::detail
@@ -0,0 +1,135 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timer_wheel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace ignite::detail;
+using namespace std::chrono_literals;
+
+namespace {
+
+/**
+ * Expire timers and return expired values in ascending order.
+ *
+ * @param wheel Timer wheel.
+ * @param now Current time.
+ * @return Expired values.
+ */
+std::vector<int> expire(timer_wheel<int> &wheel, timer_wheel<int>::clock::time_point now) {
+    std::vector<int> res;
+    wheel.expire(now, [&res](int value) { res.push_back(value); });
+    std::sort(res.begin(), res.end());
+    return res;
+}
+
+} // namespace
+
+TEST(timer_wheel, expire_in_order) {
+    auto start = timer_wheel<int>::clock::now();
+    timer_wheel<int> wheel(10ms, 8, start);
+
+    wheel.add(start + 25ms, 2);
+    wheel.add(start + 5ms, 1);
+    wheel.add(start + 30ms, 3);
+    EXPECT_EQ(3, wheel.size());
+
+    EXPECT_TRUE(expire(wheel, start + 9ms).empty());
+    EXPECT_EQ(std::vector<int>{1}, expire(wheel, start + 10ms));
+    EXPECT_TRUE(expire(wheel, start + 29ms).empty());
+    EXPECT_EQ((std::vector<int>{2, 3}), expire(wheel, start + 30ms));
+    EXPECT_EQ(0, wheel.size());
+}
+
+TEST(timer_wheel, deadline_beyond_revolution) {
+    auto start = timer_wheel<int>::clock::now();
+    timer_wheel<int> wheel(10ms, 4, start);
+
+    // Same slot as the tick 1, but three revolutions later.
+    wheel.add(start + 130ms, 1);
+    wheel.add(start + 10ms, 2);
+
+    EXPECT_EQ(std::vector<int>{2}, expire(wheel, start + 10ms));
+    EXPECT_TRUE(expire(wheel, start + 50ms).empty());
+    EXPECT_TRUE(expire(wheel, start + 129ms).empty());
+    EXPECT_EQ(std::vector<int>{1}, expire(wheel, start + 130ms));
+}
+
+TEST(timer_wheel, long_pause_expires_everything) {
+    auto start = timer_wheel<int>::clock::now();
+    timer_wheel<int> wheel(10ms, 4, start);
+
+    for (int i = 0; i < 10; ++i)
+        wheel.add(start + i * 15ms, i);
+
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), expire(wheel, start + 1s));
+    EXPECT_EQ(0, wheel.size());
+}
+
+TEST(timer_wheel, clear) {
+    auto start = timer_wheel<int>::clock::now();
+    timer_wheel<int> wheel(10ms, 4, start);
+
+    wheel.add(start + 10ms, 1);
+    wheel.add(start + 1s, 2);
+
+    std::vector<int> removed;
+    wheel.clear([&removed](int value) { removed.push_back(value); });
+    std::sort(removed.begin(), removed.end());
+
+    EXPECT_EQ((std::vector<int>{1, 2}), removed);
+    EXPECT_EQ(0, wheel.size());
+    EXPECT_TRUE(expire(wheel, start + 2s).empty());
+}
+
+TEST(timer_wheel, cancel) {
+    auto start = timer_wheel<int>::clock::now();
+    timer_wheel<int> wheel(10ms, 4, start);
+
+    auto tick1 = wheel.add(start + 10ms, 1);
+    auto tick2 = wheel.add(start + 10ms, 2);
+
+    // Same slot, next revolution.
+    auto tick3 = wheel.add(start + 50ms, 3);
+
+    EXPECT_TRUE(wheel.cancel(tick1, 1));
+    EXPECT_FALSE(wheel.cancel(tick1, 1));
+    EXPECT_FALSE(wheel.cancel(tick3, 2));
+    EXPECT_EQ(2, wheel.size());
+
+    EXPECT_EQ(std::vector<int>{2}, expire(wheel, start + 10ms));
+    EXPECT_FALSE(wheel.cancel(tick2, 2));
+
+    EXPECT_TRUE(wheel.cancel(tick3, 3));
+    EXPECT_EQ(0, wheel.size());
+    EXPECT_TRUE(expire(wheel, start + 1s).empty());
+}
+
+TEST(timer_wheel, past_deadline_expires_on_next_tick) {
+    auto start = timer_wheel<int>::clock::now();
+    timer_wheel<int> wheel(10ms, 4, start);
+
+    EXPECT_TRUE(expire(wheel, start + 100ms).empty());
+
+    wheel.add(start, 1);
+    EXPECT_TRUE(expire(wheel, start + 109ms).empty());
+    EXPECT_EQ(std::vector<int>{1}, expire(wheel, start + 110ms));
+}
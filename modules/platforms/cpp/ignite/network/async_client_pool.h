@@ -21,6 +21,8 @@
 #include <ignite/network/data_sink.h>
 #include <ignite/network/tcp_range.h>
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -40,7 +42,8 @@ public:
      * receives messages from them. Function returns either when thread is started and first connection is
      * established or failure happened.
      *
-     * @param addrs Addresses to connect to.
+     * @param addrs Addresses to connect to. A connection is established per listed address, so an address listed
+     *  several times gets several connections.
      * @param conn_limit Connection upper limit. Zero means limit is disabled.
      *
      * @throw ignite_error on error.
@@ -52,12 +55,80 @@ public:
      */
     virtual void stop() = 0;
 
+    /**
+     * Add addresses to connect to. Addresses which are already known are ignored. Like on start, an address listed
+     * several times gets several connections.
+     *
+     * @param addrs Addresses.
+     */
+    virtual void add_addresses(std::vector<tcp_range> addrs) = 0;
+
+    /**
+     * Remove addresses. Connection attempts to them are abandoned, and the connections established to them are not
+     * re-established once closed. The established connections are kept.
+     *
+     * @param addrs Addresses.
+     */
+    virtual void remove_addresses(std::vector<tcp_range> addrs) = 0;
+
     /**
      * Set handler.
      *
      * @param handler Handler to set.
      */
     virtual void set_handler(std::weak_ptr<async_handler> handler) = 0;
+
+    /**
+     * Set write combining parameters. Packets sent to a connection are held back for up to the flush delay, and
+     * the packets collected during that time are written to the socket together. Should be called before start.
+     *
+     * Pools which do not support write combining ignore the call.
+     *
+     * @param delay Flush delay. Zero means write combining is disabled.
+     * @param threshold Size of the held back packets of a connection which triggers the flush right away.
+     */
+    virtual void set_write_combining(std::chrono::microseconds delay, std::size_t threshold) {
+        (void) delay;
+        (void) threshold;
+    }
+
+    /**
+     * Set event polling parameters. Should be called before start.
+     *
+     * Pools which do not poll for events ignore the call.
+     *
+     * @param edge_triggered Whether to use edge-triggered notifications, so every readiness notification is handled
+     *  by reading the socket until there is no more data available.
+     * @param max_events Maximum number of events handled per single poll.
+     */
+    virtual void set_event_polling(bool edge_triggered, std::size_t max_events) {
+        (void) edge_triggered;
+        (void) max_events;
+    }
+
+    /**
+     * Set whether established connections are served with io_uring. Should be called before start.
+     *
+     * Pools which do not support io_uring ignore the call. Linux pool falls back to epoll if io_uring is not
+     * supported by the system.
+     *
+     * @param enabled Whether io_uring is used.
+     */
+    virtual void set_io_uring_enabled(bool enabled) { (void) enabled; }
+
+    /**
+     * Set busy polling parameters. Should be called before start.
+     *
+     * Pools which do not poll for events ignore the call.
+     *
+     * @param duration Time to poll for events without blocking before blocking. Zero means busy polling is
+     *  disabled. With busy polling, senders also try to send right away while earlier packets are pending.
+     * @param socket_options Whether to set the low latency socket options: SO_BUSY_POLL and TCP_QUICKACK.
+     */
+    virtual void set_busy_poll(std::chrono::microseconds duration, bool socket_options) {
+        (void) duration;
+        (void) socket_options;
+    }
 };
 
 } // namespace ignite::network
@@ -41,6 +41,14 @@ void async_client_pool_adapter::stop() {
     m_pool->stop();
 }
 
+void async_client_pool_adapter::add_addresses(std::vector<tcp_range> addrs) {
+    m_pool->add_addresses(std::move(addrs));
+}
+
+void async_client_pool_adapter::remove_addresses(std::vector<tcp_range> addrs) {
+    m_pool->remove_addresses(std::move(addrs));
+}
+
 void async_client_pool_adapter::set_handler(std::weak_ptr<async_handler> handler) {
     auto handler0 = std::move(handler);
     for (auto it = m_filters.rbegin(); it != m_filters.rend(); ++it) {
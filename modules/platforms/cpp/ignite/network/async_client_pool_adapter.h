@@ -54,6 +54,20 @@ public:
      */
     void stop() override;
 
+    /**
+     * Add addresses to connect to. Addresses which are already known are ignored.
+     *
+     * @param addrs Addresses.
+     */
+    void add_addresses(std::vector<tcp_range> addrs) override;
+
+    /**
+     * Remove addresses.
+     *
+     * @param addrs Addresses.
+     */
+    void remove_addresses(std::vector<tcp_range> addrs) override;
+
     /**
      * Set handler.
      *
@@ -61,6 +75,43 @@ public:
      */
     void set_handler(std::weak_ptr<async_handler> handler) override;
 
+    /**
+     * Set write combining parameters.
+     *
+     * @param delay Flush delay. Zero means write combining is disabled.
+     * @param threshold Size of the held back packets of a connection which triggers the flush right away.
+     */
+    void set_write_combining(std::chrono::microseconds delay, std::size_t threshold) override {
+        m_pool->set_write_combining(delay, threshold);
+    }
+
+    /**
+     * Set event polling parameters.
+     *
+     * @param edge_triggered Whether to use edge-triggered notifications.
+     * @param max_events Maximum number of events handled per single poll.
+     */
+    void set_event_polling(bool edge_triggered, std::size_t max_events) override {
+        m_pool->set_event_polling(edge_triggered, max_events);
+    }
+
+    /**
+     * Set whether established connections are served with io_uring.
+     *
+     * @param enabled Whether io_uring is used.
+     */
+    void set_io_uring_enabled(bool enabled) override { m_pool->set_io_uring_enabled(enabled); }
+
+    /**
+     * Set busy polling parameters.
+     *
+     * @param duration Busy polling duration. Zero means busy polling is disabled.
+     * @param socket_options Whether to set the low latency socket options.
+     */
+    void set_busy_poll(std::chrono::microseconds duration, bool socket_options) override {
+        m_pool->set_busy_poll(duration, socket_options);
+    }
+
     /**
      * Send data to specific established connection.
      *
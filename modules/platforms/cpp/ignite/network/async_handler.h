@@ -21,6 +21,7 @@
 #include <ignite/common/ignite_error.h>
 #include <ignite/network/data_buffer.h>
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 
@@ -31,6 +32,9 @@ namespace ignite::network {
  */
 class async_handler {
 public:
+    /** Interval between timer ticks. */
+    static constexpr std::chrono::milliseconds TIMER_TICK_INTERVAL{100};
+
     /**
      * Destructor.
      */
@@ -74,6 +78,13 @@ public:
      * @param id Async client ID.
      */
     virtual void on_message_sent(uint64_t id) = 0;
+
+    /**
+     * Callback that called periodically by the IO thread, roughly every TIMER_TICK_INTERVAL.
+     *
+     * Used to drive timers without dedicated threads. Must not block.
+     */
+    virtual void on_timer_tick() {}
 };
 
 } // namespace ignite::network
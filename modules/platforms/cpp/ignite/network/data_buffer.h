@@ -157,9 +157,11 @@ public:
      * @return Buffer containing consumed data.
      */
     data_buffer_owning consume_entirely() {
-        data_buffer_owning copy(*this);
-        skip(size());
-        return copy;
+        data_buffer_owning res(std::move(m_memory), m_pos);
+        m_memory.clear();
+        m_pos = 0;
+
+        return res;
     }
 
     /**
@@ -108,6 +108,14 @@ public:
         if (auto handler = m_handler.lock())
             handler->on_message_sent(id);
     }
+
+    /**
+     * Callback that called periodically by the IO thread.
+     */
+    void on_timer_tick() override {
+        if (auto handler = m_handler.lock())
+            handler->on_timer_tick();
+    }
 };
 
 } // namespace ignite::network
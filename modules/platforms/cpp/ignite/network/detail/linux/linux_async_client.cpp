@@ -18,9 +18,14 @@
 #include "linux_async_client.h"
 
 #include "../utils.h"
+#include "linux_async_worker_thread.h"
 #include "sockets.h"
 
+#include <ignite/common/detail/buffer_pool.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <climits>
 #include <cstring>
 
 #include <sys/epoll.h>
@@ -74,41 +79,172 @@ bool linux_async_client::close() {
 
 bool linux_async_client::send(std::vector<std::byte> &&data) {
     std::lock_guard<std::mutex> lock(m_send_mutex);
+    if (m_state != state::CONNECTED)
+        return false;
 
+    auto size = data.size();
     m_send_packets.emplace_back(std::move(data));
-    if (m_send_packets.size() > 1)
+
+    // Packets are already waiting for the socket to become writable, the new one is sent along with them. Unless
+    // the latency matters more, then the socket is tried anyway.
+    if (m_send_notifications && (!m_inline_send || m_ring))
         return true;
 
-    return send_next_packet_locked();
+    // With write combining the packet is held back, so the packets sent during the flush delay go out together.
+    if (m_flush_worker) {
+        m_unflushed += size;
+        if (m_unflushed < m_flush_threshold) {
+            if (!m_flush_scheduled) {
+                m_flush_scheduled = true;
+                m_flush_worker->schedule_flush(weak_from_this());
+            }
+
+            return true;
+        }
+    }
+
+    // Otherwise, try to send right away from the calling thread.
+    bool ok = send_pending_locked();
+    if (ok && m_ring)
+        ok = m_ring->submit();
+
+    return ok;
 }
 
-bool linux_async_client::send_next_packet_locked() {
-    if (m_send_packets.empty())
+bool linux_async_client::flush() {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    m_flush_scheduled = false;
+    if (m_send_notifications || m_send_packets.empty())
         return true;
 
-    auto &packet = m_send_packets.front();
-    auto dataView = packet.get_bytes_view();
+    return send_pending_locked();
+}
 
-    ssize_t ret = ::send(m_fd, dataView.data(), dataView.size(), 0);
-    if (ret < 0)
-        return false;
+bool linux_async_client::send_pending_locked() {
+    m_unflushed = 0;
+
+    if (m_ring)
+        return prepare_send_locked();
+
+    while (!m_send_packets.empty()) {
+        std::size_t total = fill_send_iov_locked();
+
+        msghdr msg{};
+        msg.msg_iov = m_send_iov.data();
+        msg.msg_iovlen = decltype(msg.msg_iovlen)(m_send_iov.size());
+
+        ssize_t ret = ::sendmsg(m_fd, &msg, 0);
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                return false;
+
+            ret = 0;
+        }
+
+        consume_sent_locked(std::size_t(ret));
+
+        // The socket buffer is full, wait until it is writable again.
+        if (std::size_t(ret) < total) {
+            if (!m_send_notifications)
+                enable_send_notifications();
 
-    packet.skip(static_cast<int32_t>(ret));
+            return true;
+        }
+    }
 
-    enable_send_notifications();
+    if (m_send_notifications)
+        disable_send_notifications();
 
     return true;
 }
 
-bytes_view linux_async_client::receive() {
-    ssize_t res = recv(m_fd, m_recv_packet.data(), m_recv_packet.size(), 0);
-    if (res < 0)
-        return {};
+bool linux_async_client::prepare_send_locked() {
+    fill_send_iov_locked();
+
+    m_send_msg = {};
+    m_send_msg.msg_iov = m_send_iov.data();
+    m_send_msg.msg_iovlen = decltype(m_send_msg.msg_iovlen)(m_send_iov.size());
+
+    auto user_data = linux_io_uring::make_user_data(m_id, linux_io_uring::op_type::SEND);
+    if (!m_ring->prepare_sendmsg(m_fd, &m_send_msg, user_data))
+        return false;
+
+    m_send_notifications = true;
+
+    return true;
+}
+
+std::size_t linux_async_client::fill_send_iov_locked() {
+    auto count = std::min(m_send_packets.size(), std::size_t(IOV_MAX));
+
+    m_send_iov.resize(count);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto data = m_send_packets[i].get_bytes_view();
+
+        m_send_iov[i].iov_base = const_cast<std::byte *>(data.data());
+        m_send_iov[i].iov_len = data.size();
+        total += data.size();
+    }
+
+    return total;
+}
+
+void linux_async_client::consume_sent_locked(std::size_t sent) {
+    // Drop the packets which were sent completely and advance the partially sent one.
+    while (!m_send_packets.empty()) {
+        auto &packet = m_send_packets.front();
+        auto size = packet.get_bytes_view().size();
+        if (sent < size) {
+            packet.skip(sent);
+            break;
+        }
+
+        sent -= size;
+        ignite::detail::buffer_pool::get_default().release(std::move(packet).extract_data());
+        m_send_packets.pop_front();
+    }
+}
 
-    return {m_recv_packet.data(), size_t(res)};
+void linux_async_client::rearm_quick_ack() {
+    if (m_quick_ack)
+        try_set_quick_ack(m_fd);
 }
 
-bool linux_async_client::start_monitoring(int epoll0) {
+bool linux_async_client::receive(bytes_view &data) {
+    // Larger chunks mean less system calls, and complete packets are decoded without copying.
+    if (m_recv_buffer_full && m_recv_packet.size() < MAX_BUFFER_SIZE)
+        m_recv_packet.resize(m_recv_packet.size() * 2);
+
+    data = {};
+    ssize_t res;
+    do {
+        res = recv(m_fd, m_recv_packet.data(), m_recv_packet.size(), 0);
+    } while (res < 0 && errno == EINTR);
+
+    if (res < 0) {
+        m_recv_buffer_full = false;
+
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+
+    // Zero means the connection is closed by the peer.
+    if (res == 0)
+        return false;
+
+    rearm_quick_ack();
+
+    m_recv_buffer_full = size_t(res) == m_recv_packet.size();
+    data = {m_recv_packet.data(), size_t(res)};
+
+    return true;
+}
+
+bool linux_async_client::start_monitoring(int epoll0, bool edge_triggered) {
     if (epoll0 < 0)
         return false;
 
@@ -116,12 +252,16 @@ bool linux_async_client::start_monitoring(int epoll0) {
     memset(&event, 0, sizeof(event));
     event.data.ptr = this;
     event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP;
+    if (edge_triggered)
+        event.events |= EPOLLET;
 
     int res = epoll_ctl(epoll0, EPOLL_CTL_ADD, m_fd, &event);
     if (res < 0)
         return false;
 
     m_epoll = epoll0;
+    m_edge_triggered = edge_triggered;
+    m_send_notifications = true;
 
     return true;
 }
@@ -135,6 +275,12 @@ void linux_async_client::stop_monitoring() // NOLINT(readability-make-member-fun
 }
 
 void linux_async_client::enable_send_notifications() {
+    m_send_notifications = true;
+
+    // Edge-triggered send notifications stay registered and only come when the socket becomes writable.
+    if (m_edge_triggered)
+        return;
+
     epoll_event event{};
     memset(&event, 0, sizeof(event));
     event.data.ptr = this;
@@ -144,6 +290,11 @@ void linux_async_client::enable_send_notifications() {
 }
 
 void linux_async_client::disable_send_notifications() {
+    m_send_notifications = false;
+
+    if (m_edge_triggered)
+        return;
+
     epoll_event event{};
     memset(&event, 0, sizeof(event));
     event.data.ptr = this;
@@ -155,16 +306,47 @@ void linux_async_client::disable_send_notifications() {
 bool linux_async_client::process_sent() {
     std::lock_guard<std::mutex> lock(m_send_mutex);
 
-    if (m_send_packets.empty()) {
-        disable_send_notifications();
+    return send_pending_locked();
+}
 
-        return true;
+bool linux_async_client::process_sent(std::int32_t res) {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    m_send_notifications = false;
+    if (m_state != state::CONNECTED)
+        return false;
+
+    if (res < 0) {
+        if (res != -EINTR && res != -EAGAIN)
+            return false;
+
+        res = 0;
     }
 
-    if (m_send_packets.front().empty())
-        m_send_packets.pop_front();
+    consume_sent_locked(std::size_t(res));
+    if (m_send_packets.empty())
+        return true;
+
+    return prepare_send_locked();
+}
+
+void linux_async_client::set_io_uring(linux_io_uring *ring) {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    m_ring = ring;
+    m_send_notifications = false;
+}
+
+bool linux_async_client::is_sending() {
+    std::lock_guard<std::mutex> lock(m_send_mutex);
+
+    return m_ring && m_send_notifications;
+}
+
+bool linux_async_client::prepare_receive() {
+    auto user_data = linux_io_uring::make_user_data(m_id, linux_io_uring::op_type::RECV);
 
-    return send_next_packet_locked();
+    return m_ring->prepare_recv(m_fd, user_data);
 }
 
 } // namespace ignite::network::detail
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "linux_io_uring.h"
 #include "sockets.h"
 
 #include "ignite/common/end_point.h"
@@ -28,13 +29,18 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <vector>
+
+#include <sys/uio.h>
 
 namespace ignite::network::detail {
 
+class linux_async_worker_thread;
+
 /**
  * Linux-specific implementation of async network client.
  */
-class linux_async_client {
+class linux_async_client : public std::enable_shared_from_this<linux_async_client> {
     /**
      * State.
      */
@@ -49,6 +55,9 @@ class linux_async_client {
 public:
     static constexpr size_t BUFFER_SIZE = 0x10000;
 
+    /** Receive buffer grows up to this size while the received data fills it completely. */
+    static constexpr size_t MAX_BUFFER_SIZE = 0x100000;
+
     /**
      * Constructor.
      *
@@ -96,11 +105,51 @@ public:
     bool send(std::vector<std::byte> &&data);
 
     /**
-     * Initiate next receive of data.
+     * Send packets held back by write combining, unless the socket is not writable at the moment.
      *
      * @return @c true on success.
      */
-    bytes_view receive();
+    bool flush();
+
+    /**
+     * Enable write combining. Packets are held back until the worker thread flushes them or the size of the
+     * held back packets reaches the threshold, so packets sent at about the same time go out with a single
+     * system call.
+     *
+     * Should be called before the client is added to the pool.
+     *
+     * @param worker Worker thread which schedules flushes.
+     * @param threshold Size of the held back packets which triggers the flush right away.
+     */
+    void set_write_combining(linux_async_worker_thread *worker, std::size_t threshold) {
+        m_flush_worker = worker;
+        m_flush_threshold = threshold;
+    }
+
+    /**
+     * Set low latency parameters. Should be called before the client is added to the pool.
+     *
+     * @param inline_send Whether to try to send right away from the calling thread even when earlier packets wait
+     *  for the socket to become writable. Not applied with io_uring, which has a single send in progress at most.
+     * @param quick_ack Whether to re-enable TCP_QUICKACK after every read, as the system resets it.
+     */
+    void set_low_latency(bool inline_send, bool quick_ack) {
+        m_inline_send = inline_send;
+        m_quick_ack = quick_ack;
+    }
+
+    /**
+     * Re-enable TCP_QUICKACK if requested. Should be called after the data is read.
+     */
+    void rearm_quick_ack();
+
+    /**
+     * Receive the next chunk of data.
+     *
+     * @param data Received data. Empty if there is no data available at the moment.
+     * @return @c true on success and @c false if the connection is closed or failed.
+     */
+    bool receive(bytes_view &data);
 
     /**
      * Process sent data.
@@ -109,13 +158,46 @@ public:
      */
     bool process_sent();
 
+    /**
+     * Process completion of the send submitted to io_uring, and prepare the send of the packets queued meanwhile.
+     *
+     * @param res Result of the send: number of bytes sent or negated error code.
+     * @return @c true on success.
+     */
+    bool process_sent(std::int32_t res);
+
+    /**
+     * Switch the client to io_uring. The packets are sent with io_uring submissions from then on. Should be called
+     * once the connection is established and before the client is added to the pool.
+     *
+     * @param ring Ring.
+     */
+    void set_io_uring(linux_io_uring *ring);
+
+    /**
+     * Check whether an io_uring send is in progress.
+     *
+     * @return @c true if an io_uring send is in progress.
+     */
+    bool is_sending();
+
+    /**
+     * Prepare multishot receive with io_uring.
+     *
+     * @return @c true on success.
+     */
+    bool prepare_receive();
+
     /**
      * Start monitoring client.
      *
      * @param epoll Epoll file descriptor.
+     * @param edge_triggered Whether to use edge-triggered notifications. With edge-triggered notifications, send
+     *  notifications stay registered, as they only come when the socket becomes writable, and the received data
+     *  should be read until there is no more data available.
      * @return @c true on success.
      */
-    bool start_monitoring(int epoll);
+    bool start_monitoring(int epoll, bool edge_triggered);
 
     /**
      * Stop monitoring client.
@@ -176,12 +258,37 @@ public:
 
 private:
     /**
-     * Send next packet in queue.
+     * Send as many queued packets as the socket accepts, with a single system call per batch. Send notifications
+     * are only enabled when the socket can not accept more data.
+     *
+     * @warning Can only be called when holding m_send_mutex lock.
+     * @return @c true on success.
+     */
+    bool send_pending_locked();
+
+    /**
+     * Prepare send of the queued packets with io_uring. The submission is performed by the caller.
      *
      * @warning Can only be called when holding m_send_mutex lock.
      * @return @c true on success.
      */
-    bool send_next_packet_locked();
+    bool prepare_send_locked();
+
+    /**
+     * Fill the buffers of the next batch of queued packets.
+     *
+     * @warning Can only be called when holding m_send_mutex lock.
+     * @return Total size of the batch.
+     */
+    std::size_t fill_send_iov_locked();
+
+    /**
+     * Drop the packets which were sent completely and advance the partially sent one.
+     *
+     * @warning Can only be called when holding m_send_mutex lock.
+     * @param sent Number of bytes sent.
+     */
+    void consume_sent_locked(std::size_t sent);
 
     /** State. */
     state m_state;
@@ -204,12 +311,51 @@ private:
     /** Packets that should be sent. */
     std::deque<data_buffer_owning> m_send_packets;
 
+    /** Buffers of the packets passed to a single sendmsg call. Protected by m_send_mutex. */
+    std::vector<iovec> m_send_iov;
+
+    /** Message passed to the io_uring send. Stays unchanged until the send completes. Protected by m_send_mutex. */
+    msghdr m_send_msg{};
+
+    /** Ring used for IO. Null if epoll is used. */
+    linux_io_uring *m_ring{nullptr};
+
+    /**
+     * Whether send notifications are enabled, or, with io_uring, whether a send is in progress. Either way, the
+     * packets are sent later by the worker thread. Protected by m_send_mutex.
+     */
+    bool m_send_notifications{true};
+
+    /** Worker thread which flushes held back packets. Null if write combining is disabled. */
+    linux_async_worker_thread *m_flush_worker{nullptr};
+
+    /** Size of the held back packets which triggers the flush right away. */
+    std::size_t m_flush_threshold{0};
+
+    /** Size of the packets queued since the last send attempt. Protected by m_send_mutex. */
+    std::size_t m_unflushed{0};
+
+    /** Whether the flush is scheduled with the worker thread. Protected by m_send_mutex. */
+    bool m_flush_scheduled{false};
+
+    /** Whether the calling thread tries to send right away even when earlier packets are pending. */
+    bool m_inline_send{false};
+
+    /** Whether TCP_QUICKACK is re-enabled after every read. */
+    bool m_quick_ack{false};
+
     /** Send critical section. */
     std::mutex m_send_mutex;
 
+    /** Whether edge-triggered notifications are used. */
+    bool m_edge_triggered{false};
+
     /** Packet that is currently received. */
     std::vector<std::byte> m_recv_packet;
 
+    /** Whether the last received chunk filled the receive buffer completely. */
+    bool m_recv_buffer_full{false};
+
     /** Closing error. */
     std::optional<ignite_error> m_close_err{};
 };
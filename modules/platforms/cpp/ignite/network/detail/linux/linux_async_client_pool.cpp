@@ -24,10 +24,14 @@
 
 namespace ignite::network::detail {
 
-linux_async_client_pool::linux_async_client_pool()
+linux_async_client_pool::linux_async_client_pool(std::uint32_t io_threads)
     : m_stopping(true)
     , m_async_handler()
-    , m_worker_thread(*this)
+    , m_io_threads(std::max(io_threads, std::uint32_t(1)))
+    , m_worker_threads()
+    , m_known_addrs()
+    , m_next_worker(0)
+    , m_workers_mutex()
     , m_id_gen(0)
     , m_clients_mutex()
     , m_client_id_map() {
@@ -45,7 +49,34 @@ void linux_async_client_pool::start(const std::vector<tcp_range> addrs, uint32_t
     m_stopping = false;
 
     try {
-        m_worker_thread.start(conn_limit, addrs);
+        std::lock_guard<std::mutex> lock(m_workers_mutex);
+
+        std::size_t threads = m_io_threads;
+        if (conn_limit && conn_limit < threads)
+            threads = conn_limit;
+
+        // Both addresses and the connection limit are split between threads, so every connection is owned by a
+        // single thread and is never touched by the others.
+        std::vector<std::vector<tcp_range>> shards(threads);
+        for (std::size_t i = 0; i < addrs.size(); ++i)
+            shards[i % threads].push_back(addrs[i]);
+
+        m_known_addrs = addrs;
+        m_next_worker = addrs.size() % threads;
+
+        m_worker_threads.clear();
+        for (std::size_t i = 0; i < threads; ++i) {
+            m_worker_threads.push_back(std::make_unique<linux_async_worker_thread>(*this, i == 0));
+            m_worker_threads.back()->set_write_combining(m_flush_delay, m_flush_threshold);
+            m_worker_threads.back()->set_event_polling(m_edge_triggered, m_max_events);
+            m_worker_threads.back()->set_io_uring_enabled(m_io_uring_enabled);
+            m_worker_threads.back()->set_busy_poll(m_busy_poll, m_low_latency_sockets);
+        }
+
+        for (std::size_t i = 0; i < threads; ++i) {
+            std::size_t limit = conn_limit ? conn_limit / threads + (i < conn_limit % threads ? 1 : 0) : 0;
+            m_worker_threads[i]->start(limit, std::move(shards[i]));
+        }
     } catch (...) {
         stop();
 
@@ -57,6 +88,46 @@ void linux_async_client_pool::stop() {
     internal_stop();
 }
 
+void linux_async_client_pool::add_addresses(std::vector<tcp_range> addrs) {
+    std::lock_guard<std::mutex> lock(m_workers_mutex);
+
+    if (m_worker_threads.empty())
+        return;
+
+    // Only addresses known before are skipped, as an address may be listed several times.
+    auto known_end = m_known_addrs.size();
+
+    std::vector<std::vector<tcp_range>> shards(m_worker_threads.size());
+    for (auto &addr : addrs) {
+        auto known_last = m_known_addrs.begin() + std::ptrdiff_t(known_end);
+        if (std::find(m_known_addrs.begin(), known_last, addr) != known_last)
+            continue;
+
+        m_known_addrs.push_back(addr);
+        shards[m_next_worker].push_back(std::move(addr));
+        m_next_worker = (m_next_worker + 1) % m_worker_threads.size();
+    }
+
+    for (std::size_t i = 0; i < shards.size(); ++i) {
+        if (!shards[i].empty())
+            m_worker_threads[i]->add_addresses(std::move(shards[i]));
+    }
+}
+
+void linux_async_client_pool::remove_addresses(std::vector<tcp_range> addrs) {
+    std::lock_guard<std::mutex> lock(m_workers_mutex);
+
+    if (m_worker_threads.empty())
+        return;
+
+    for (const auto &addr : addrs)
+        m_known_addrs.erase(std::remove(m_known_addrs.begin(), m_known_addrs.end(), addr), m_known_addrs.end());
+
+    // Copies of an address can be owned by several threads.
+    for (auto &worker : m_worker_threads)
+        worker->remove_addresses(addrs);
+}
+
 bool linux_async_client_pool::send(uint64_t id, std::vector<std::byte> &&data) {
     if (m_stopping)
         throw ignite_error("Client is stopped");
@@ -146,9 +217,22 @@ void linux_async_client_pool::handle_message_sent(uint64_t id) {
         handler->on_message_sent(id);
 }
 
+void linux_async_client_pool::handle_timer_tick() {
+    if (auto handler = m_async_handler.lock())
+        handler->on_timer_tick();
+}
+
 void linux_async_client_pool::internal_stop() {
     m_stopping = true;
-    m_worker_thread.stop();
+
+    // Not under the lock: worker threads may add addresses while they are being stopped.
+    for (auto &worker : m_worker_threads)
+        worker->stop();
+
+    {
+        std::lock_guard<std::mutex> lock(m_workers_mutex);
+        m_known_addrs.clear();
+    }
 
     {
         std::lock_guard<std::mutex> lock(m_clients_mutex);
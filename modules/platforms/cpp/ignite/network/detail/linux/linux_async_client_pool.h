@@ -25,10 +25,12 @@
 #include <ignite/network/async_handler.h>
 #include <ignite/network/tcp_range.h>
 
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace ignite::network::detail {
 
@@ -40,9 +42,9 @@ public:
     /**
      * Constructor
      *
-     * @param handler Upper level event handler.
+     * @param io_threads Number of IO threads. Every thread has its own epoll instance and owns its connections.
      */
-    linux_async_client_pool();
+    explicit linux_async_client_pool(std::uint32_t io_threads);
 
     /**
      * Destructor.
@@ -66,6 +68,20 @@ public:
      */
     void stop() override;
 
+    /**
+     * Add addresses to connect to. Addresses which are already known are ignored.
+     *
+     * @param addrs Addresses.
+     */
+    void add_addresses(std::vector<tcp_range> addrs) override;
+
+    /**
+     * Remove addresses. The established connections are kept, but are not re-established once closed.
+     *
+     * @param addrs Addresses.
+     */
+    void remove_addresses(std::vector<tcp_range> addrs) override;
+
     /**
      * Set handler.
      *
@@ -73,6 +89,46 @@ public:
      */
     void set_handler(std::weak_ptr<async_handler> handler) override { m_async_handler = std::move(handler); }
 
+    /**
+     * Set write combining parameters.
+     *
+     * @param delay Flush delay. Zero means write combining is disabled.
+     * @param threshold Size of the held back packets of a connection which triggers the flush right away.
+     */
+    void set_write_combining(std::chrono::microseconds delay, std::size_t threshold) override {
+        m_flush_delay = delay;
+        m_flush_threshold = threshold;
+    }
+
+    /**
+     * Set event polling parameters.
+     *
+     * @param edge_triggered Whether to use edge-triggered notifications.
+     * @param max_events Maximum number of events handled per single poll.
+     */
+    void set_event_polling(bool edge_triggered, std::size_t max_events) override {
+        m_edge_triggered = edge_triggered;
+        m_max_events = max_events;
+    }
+
+    /**
+     * Set whether established connections are served with io_uring.
+     *
+     * @param enabled Whether io_uring is used.
+     */
+    void set_io_uring_enabled(bool enabled) override { m_io_uring_enabled = enabled; }
+
+    /**
+     * Set busy polling parameters.
+     *
+     * @param duration Busy polling duration. Zero means busy polling is disabled.
+     * @param socket_options Whether to set the low latency socket options.
+     */
+    void set_busy_poll(std::chrono::microseconds duration, bool socket_options) override {
+        m_busy_poll = duration;
+        m_low_latency_sockets = socket_options;
+    }
+
     /**
      * Send data to specific established connection.
      *
@@ -149,6 +205,11 @@ public:
      */
     void handle_message_sent(uint64_t id);
 
+    /**
+     * Handle timer tick event.
+     */
+    void handle_timer_tick();
+
 private:
     /**
      * Close all established connections and stops handling threads.
@@ -169,8 +230,41 @@ private:
     /** Event handler. */
     std::weak_ptr<async_handler> m_async_handler;
 
-    /** Worker thread. */
-    linux_async_worker_thread m_worker_thread;
+    /** Number of IO threads. */
+    const std::uint32_t m_io_threads;
+
+    /** Worker threads. Addresses are distributed between them round-robin. */
+    std::vector<std::unique_ptr<linux_async_worker_thread>> m_worker_threads;
+
+    /** Write combining flush delay. Zero means write combining is disabled. */
+    std::chrono::microseconds m_flush_delay{0};
+
+    /** Size of the held back packets of a connection which triggers the flush right away. */
+    std::size_t m_flush_threshold{0};
+
+    /** Whether edge-triggered notifications are used. */
+    bool m_edge_triggered{false};
+
+    /** Maximum number of events handled per single poll. */
+    std::size_t m_max_events{16};
+
+    /** Whether io_uring is requested. */
+    bool m_io_uring_enabled{false};
+
+    /** Busy polling duration. Zero means busy polling is disabled. */
+    std::chrono::microseconds m_busy_poll{0};
+
+    /** Whether the low latency socket options are set. */
+    bool m_low_latency_sockets{false};
+
+    /** Known addresses. */
+    std::vector<tcp_range> m_known_addrs;
+
+    /** Worker thread to assign the next added address to. */
+    std::size_t m_next_worker;
+
+    /** Worker threads and addresses mutex. */
+    std::mutex m_workers_mutex;
 
     /** ID counter. */
     uint64_t m_id_gen;
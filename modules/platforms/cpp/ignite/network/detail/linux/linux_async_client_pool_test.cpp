@@ -0,0 +1,451 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "linux_async_client_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::network;
+using namespace ignite::network::detail;
+
+namespace {
+
+/** Time to wait for the pool to react. */
+constexpr std::chrono::seconds WAIT_TIMEOUT{10};
+
+/**
+ * Listening socket on the loopback interface.
+ */
+class local_server {
+public:
+    /**
+     * Constructor.
+     */
+    local_server() {
+        m_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        socklen_t len = sizeof(addr);
+        if (::bind(m_fd, reinterpret_cast<sockaddr *>(&addr), len) != 0 || ::listen(m_fd, 16) != 0
+            || ::getsockname(m_fd, reinterpret_cast<sockaddr *>(&addr), &len) != 0)
+            throw std::runtime_error("Can not start the local server");
+
+        m_port = ntohs(addr.sin_port);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~local_server() {
+        for (auto fd : m_accepted)
+            ::close(fd);
+
+        ::close(m_fd);
+    }
+
+    /**
+     * Get the address range of the server.
+     *
+     * @return Address range.
+     */
+    [[nodiscard]] tcp_range get_range() const { return {"127.0.0.1", m_port, m_port}; }
+
+    /**
+     * Accept a connection.
+     *
+     * @return Accepted socket or -1 on timeout.
+     */
+    int accept() {
+        pollfd pfd{m_fd, POLLIN, 0};
+        if (::poll(&pfd, 1, int(std::chrono::milliseconds(WAIT_TIMEOUT).count())) <= 0)
+            return -1;
+
+        int fd = ::accept(m_fd, nullptr, nullptr);
+        if (fd >= 0)
+            m_accepted.push_back(fd);
+
+        return fd;
+    }
+
+    /**
+     * Read from an accepted socket until the expected number of bytes is received or the time is out.
+     *
+     * @param fd Accepted socket.
+     * @param expected Expected number of bytes.
+     * @param timeout Timeout.
+     * @return Number of received bytes.
+     */
+    static std::size_t read(int fd, std::size_t expected, std::chrono::milliseconds timeout) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        std::size_t received = 0;
+        char buf[4096];
+        while (received < expected) {
+            auto left = deadline - std::chrono::steady_clock::now();
+            auto left_ms = std::chrono::duration_cast<std::chrono::milliseconds>(left).count();
+
+            pollfd pfd{fd, POLLIN, 0};
+            if (left_ms <= 0 || ::poll(&pfd, 1, int(left_ms)) <= 0)
+                break;
+
+            auto res = ::recv(fd, buf, sizeof(buf), 0);
+            if (res <= 0)
+                break;
+
+            received += std::size_t(res);
+        }
+
+        return received;
+    }
+
+private:
+    /** Listening socket. */
+    int m_fd{-1};
+
+    /** Port. */
+    std::uint16_t m_port{0};
+
+    /** Accepted sockets. */
+    std::vector<int> m_accepted;
+};
+
+/**
+ * Handler recording the threads the events are delivered on.
+ */
+class recording_handler : public async_handler {
+public:
+    void on_connection_success(const end_point &, uint64_t id) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_connection_threads[id] = std::this_thread::get_id();
+        m_cond.notify_all();
+    }
+
+    void on_connection_error(const end_point &, ignite_error) override {}
+
+    void on_connection_closed(uint64_t, std::optional<ignite_error>) override {}
+
+    void on_message_received(uint64_t id, bytes_view msg) override {
+        bool first;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            first = m_received.find(id) == m_received.end();
+            m_received[id] += msg.size();
+            m_message_threads[id].insert(std::this_thread::get_id());
+            m_cond.notify_all();
+        }
+
+        if (first)
+            std::this_thread::sleep_for(m_first_message_delay);
+    }
+
+    void on_message_sent(uint64_t) override {}
+
+    /**
+     * Wait until the condition over the handler holds.
+     *
+     * @param pred Condition. Called under the lock.
+     * @return @c true if the condition holds.
+     */
+    bool wait_for(const std::function<bool()> &pred) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_cond.wait_for(lock, WAIT_TIMEOUT, pred);
+    }
+
+    /** Time the IO thread is held by the first message of every connection. */
+    std::chrono::milliseconds m_first_message_delay{0};
+
+    /** Threads the connections were established on, by connection IDs. */
+    std::map<uint64_t, std::thread::id> m_connection_threads;
+
+    /** Threads the messages were received on, by connection IDs. */
+    std::map<uint64_t, std::set<std::thread::id>> m_message_threads;
+
+    /** Number of received bytes, by connection IDs. */
+    std::map<uint64_t, std::size_t> m_received;
+
+    /** Mutex. */
+    std::mutex m_mutex;
+
+    /** Condition variable. */
+    std::condition_variable m_cond;
+};
+
+/**
+ * Count io_uring instances open in the process.
+ *
+ * @return Number of io_uring instances.
+ */
+std::size_t count_io_uring_instances() {
+    DIR *dir = ::opendir("/proc/self/fd");
+    if (!dir)
+        return 0;
+
+    std::size_t count = 0;
+    while (auto entry = ::readdir(dir)) {
+        std::string path = std::string("/proc/self/fd/") + entry->d_name;
+
+        char target[256];
+        auto len = ::readlink(path.c_str(), target, sizeof(target) - 1);
+        if (len > 0 && std::string(target, std::size_t(len)) == "anon_inode:[io_uring]")
+            ++count;
+    }
+
+    ::closedir(dir);
+
+    return count;
+}
+
+/**
+ * Get the CPU time consumed by the process.
+ *
+ * @return CPU time.
+ */
+std::chrono::nanoseconds get_process_cpu_time() {
+    timespec ts{};
+    ::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+/**
+ * Measure the CPU time the process consumes while the pool is idle.
+ *
+ * @param busy_poll Busy poll duration.
+ * @return CPU time.
+ */
+std::chrono::nanoseconds measure_idle_cpu_time(std::chrono::microseconds busy_poll) {
+    local_server server;
+    auto handler = std::make_shared<recording_handler>();
+
+    linux_async_client_pool pool(1);
+    pool.set_handler(handler);
+    pool.set_busy_poll(busy_poll, true);
+    pool.start({server.get_range()}, 0);
+
+    int fd = server.accept();
+    EXPECT_GE(fd, 0);
+    EXPECT_TRUE(handler->wait_for([&] { return !handler->m_connection_threads.empty(); }));
+
+    auto start = get_process_cpu_time();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    auto cpu_time = get_process_cpu_time() - start;
+
+    // The connection still works, the data sent by the peer is delivered.
+    char data = 0;
+    EXPECT_EQ(1, ::send(fd, &data, 1, 0));
+    auto id = handler->m_connection_threads.begin()->first;
+    EXPECT_TRUE(handler->wait_for([&] { return handler->m_received[id] == 1; }));
+
+    pool.stop();
+
+    return cpu_time;
+}
+
+} // namespace
+
+TEST(linux_async_client_pool, connections_are_split_between_io_threads) {
+    constexpr std::size_t connections = 4;
+
+    local_server server;
+    auto handler = std::make_shared<recording_handler>();
+
+    linux_async_client_pool pool(2);
+    pool.set_handler(handler);
+    pool.start(std::vector<tcp_range>(connections, server.get_range()), 0);
+
+    std::vector<int> accepted;
+    for (std::size_t i = 0; i < connections; ++i) {
+        accepted.push_back(server.accept());
+        ASSERT_GE(accepted.back(), 0);
+    }
+
+    ASSERT_TRUE(handler->wait_for([&] { return handler->m_connection_threads.size() == connections; }));
+
+    const char data[] = "data";
+    for (auto fd : accepted)
+        ASSERT_EQ(ssize_t(sizeof(data)), ::send(fd, data, sizeof(data), 0));
+
+    ASSERT_TRUE(handler->wait_for([&] {
+        for (auto &[id, _] : handler->m_connection_threads) {
+            if (handler->m_received[id] < sizeof(data))
+                return false;
+        }
+        return true;
+    }));
+
+    pool.stop();
+
+    std::set<std::thread::id> threads;
+    for (auto &[id, thread] : handler->m_connection_threads) {
+        threads.insert(thread);
+
+        // A connection is served by the thread that established it only.
+        EXPECT_EQ(std::set<std::thread::id>{thread}, handler->m_message_threads[id]);
+    }
+
+    EXPECT_EQ(2, threads.size());
+}
+
+TEST(linux_async_client_pool, write_combining_holds_small_packets_back) {
+    local_server server;
+    auto handler = std::make_shared<recording_handler>();
+
+    linux_async_client_pool pool(1);
+    pool.set_handler(handler);
+    pool.set_write_combining(std::chrono::seconds(1), 1024);
+    pool.start({server.get_range()}, 0);
+
+    int fd = server.accept();
+    ASSERT_GE(fd, 0);
+    ASSERT_TRUE(handler->wait_for([&] { return !handler->m_connection_threads.empty(); }));
+
+    auto id = handler->m_connection_threads.begin()->first;
+
+    // Let the worker handle the first writable notification of the new connection.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    for (int i = 0; i < 10; ++i)
+        ASSERT_TRUE(pool.send(id, std::vector<std::byte>(10)));
+
+    // The packets stay in the client until the flush delay passes, then go out together.
+    EXPECT_EQ(0, local_server::read(fd, 1, std::chrono::milliseconds(200)));
+    EXPECT_EQ(100, local_server::read(fd, 100, WAIT_TIMEOUT));
+
+    // Reaching the threshold sends the packets without waiting.
+    ASSERT_TRUE(pool.send(id, std::vector<std::byte>(2048)));
+    EXPECT_EQ(2048, local_server::read(fd, 2048, std::chrono::milliseconds(500)));
+
+    pool.stop();
+}
+
+TEST(linux_async_client_pool, edge_triggered_io_drains_sockets) {
+    // More than a single read takes, but few enough to fit in the socket buffers, so no new edge comes after it.
+    constexpr std::size_t size = 96 * 1024;
+
+    local_server server;
+    auto handler = std::make_shared<recording_handler>();
+    handler->m_first_message_delay = std::chrono::milliseconds(500);
+
+    linux_async_client_pool pool(1);
+    pool.set_handler(handler);
+    pool.set_event_polling(true, 16);
+    pool.start({server.get_range()}, 0);
+
+    int fd = server.accept();
+    ASSERT_GE(fd, 0);
+    ASSERT_TRUE(handler->wait_for([&] { return !handler->m_connection_threads.empty(); }));
+
+    auto id = handler->m_connection_threads.begin()->first;
+
+    // The data arrives while the IO thread is busy with the first message, so it is all reported by one edge.
+    char first = 0;
+    ASSERT_EQ(1, ::send(fd, &first, 1, 0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::vector<char> data(size);
+    std::size_t sent = 0;
+    while (sent < size) {
+        auto res = ::send(fd, data.data() + sent, size - sent, 0);
+        ASSERT_GT(res, 0);
+        sent += std::size_t(res);
+    }
+
+    EXPECT_TRUE(handler->wait_for([&] { return handler->m_received[id] == size + 1; }));
+
+    // Sending much more than the socket buffers take needs every writable edge to be handled.
+    constexpr std::size_t large_size = 4 * 1024 * 1024;
+    ASSERT_TRUE(pool.send(id, std::vector<std::byte>(large_size)));
+    EXPECT_EQ(large_size, local_server::read(fd, large_size, WAIT_TIMEOUT));
+
+    pool.stop();
+}
+
+TEST(linux_async_client_pool, io_uring_serves_connections) {
+    // Without io_uring the pool falls back to epoll, which the other tests cover.
+    if (!linux_io_uring::is_supported())
+        return;
+
+    constexpr std::size_t size = 1024 * 1024;
+
+    local_server server;
+    auto handler = std::make_shared<recording_handler>();
+    auto rings = count_io_uring_instances();
+
+    linux_async_client_pool pool(1);
+    pool.set_handler(handler);
+    pool.set_io_uring_enabled(true);
+    pool.start({server.get_range()}, 0);
+
+    int fd = server.accept();
+    ASSERT_GE(fd, 0);
+    ASSERT_TRUE(handler->wait_for([&] { return !handler->m_connection_threads.empty(); }));
+
+    // The worker serves its connections with a ring of its own.
+    EXPECT_EQ(rings + 1, count_io_uring_instances());
+
+    auto id = handler->m_connection_threads.begin()->first;
+
+    // Much more than the provided buffers hold, so they are recycled.
+    std::vector<char> data(size);
+    std::size_t sent = 0;
+    while (sent < size) {
+        auto res = ::send(fd, data.data() + sent, size - sent, 0);
+        ASSERT_GT(res, 0);
+        sent += std::size_t(res);
+    }
+
+    EXPECT_TRUE(handler->wait_for([&] { return handler->m_received[id] == size; }));
+
+    ASSERT_TRUE(pool.send(id, std::vector<std::byte>(size)));
+    EXPECT_EQ(size, local_server::read(fd, size, WAIT_TIMEOUT));
+
+    pool.stop();
+
+    EXPECT_EQ(rings, count_io_uring_instances());
+}
+
+TEST(linux_async_client_pool, busy_poll_spins_before_blocking) {
+    // While the pool is idle, the IO thread waits for the events without using the CPU, unless it busy polls.
+    auto blocking = measure_idle_cpu_time(std::chrono::microseconds(0));
+    auto spinning = measure_idle_cpu_time(std::chrono::seconds(1));
+
+    EXPECT_LT(blocking, std::chrono::milliseconds(100));
+    EXPECT_GT(spinning, std::chrono::milliseconds(200));
+}
@@ -0,0 +1,169 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "linux_async_client.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::network;
+using namespace ignite::network::detail;
+
+namespace {
+
+/**
+ * Client connected to a local peer with a socket pair.
+ */
+class socket_pair_client {
+public:
+    /**
+     * Constructor.
+     *
+     * @param send_buffer Send buffer size of the client socket.
+     */
+    explicit socket_pair_client(int send_buffer) {
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0)
+            throw std::runtime_error("Can not create a socket pair");
+
+        ::setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &send_buffer, sizeof(send_buffer));
+
+        m_peer = fds[1];
+        m_epoll = ::epoll_create1(0);
+        m_client =
+            std::make_unique<linux_async_client>(fds[0], end_point{"127.0.0.1", 0}, tcp_range{"127.0.0.1", 0, 0});
+
+        // The packets are queued until the socket is reported writable, as by the worker thread.
+        m_client->start_monitoring(m_epoll, false);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~socket_pair_client() {
+        m_client.reset();
+
+        ::close(m_epoll);
+        ::close(m_peer);
+    }
+
+    /**
+     * Read everything the peer has received so far.
+     */
+    void read_peer() {
+        std::byte buf[4096];
+        ssize_t res;
+        while ((res = ::recv(m_peer, buf, sizeof(buf), 0)) > 0)
+            m_received.insert(m_received.end(), buf, buf + res);
+    }
+
+    /** Client. */
+    std::unique_ptr<linux_async_client> m_client;
+
+    /** Data received by the peer. */
+    std::vector<std::byte> m_received;
+
+private:
+    /** Peer socket. */
+    int m_peer{-1};
+
+    /** Epoll instance. */
+    int m_epoll{-1};
+};
+
+/**
+ * Make packets of the specified size with distinct contents.
+ *
+ * @param count Number of packets.
+ * @param size Packet size.
+ * @return Packets.
+ */
+std::vector<std::vector<std::byte>> make_packets(std::size_t count, std::size_t size) {
+    std::vector<std::vector<std::byte>> packets;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::vector<std::byte> packet(size);
+        for (std::size_t j = 0; j < size; ++j)
+            packet[j] = std::byte((i * 31 + j) & 0xFF);
+
+        packets.push_back(std::move(packet));
+    }
+
+    return packets;
+}
+
+/**
+ * Concatenate packets.
+ *
+ * @param packets Packets.
+ * @return Concatenated packets.
+ */
+std::vector<std::byte> concat(const std::vector<std::vector<std::byte>> &packets) {
+    std::vector<std::byte> res;
+    for (auto &packet : packets)
+        res.insert(res.end(), packet.begin(), packet.end());
+
+    return res;
+}
+
+} // namespace
+
+TEST(linux_async_client, partial_sends_keep_the_rest_queued) {
+    socket_pair_client pair(4096);
+
+    // Packet size is not a divisor of the buffer size, so the sends end in the middle of a packet.
+    auto packets = make_packets(64, 997);
+    auto expected = concat(packets);
+
+    for (auto packet : packets)
+        ASSERT_TRUE(pair.m_client->send(std::move(packet)));
+
+    int rounds = 0;
+    while (pair.m_received.size() < expected.size() && rounds < 1000) {
+        ASSERT_TRUE(pair.m_client->process_sent());
+        pair.read_peer();
+        ++rounds;
+    }
+
+    EXPECT_GT(rounds, 1);
+    EXPECT_EQ(expected, pair.m_received);
+}
+
+TEST(linux_async_client, more_packets_than_iov_max_are_sent_in_batches) {
+    socket_pair_client pair(1024 * 1024);
+
+    auto packets = make_packets(IOV_MAX * 2 + 5, 3);
+    auto expected = concat(packets);
+
+    for (auto packet : packets)
+        ASSERT_TRUE(pair.m_client->send(std::move(packet)));
+
+    // A single writable notification sends all the batches as long as the socket accepts them.
+    ASSERT_TRUE(pair.m_client->process_sent());
+    pair.read_peer();
+
+    EXPECT_EQ(expected, pair.m_received);
+}
@@ -21,12 +21,15 @@
 #include "linux_async_client_pool.h"
 
 #include <algorithm>
+#include <cerrno>
 #include <cstring>
+#include <optional>
 
 #include <netdb.h>
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
 #include <sys/socket.h>
+#include <sys/timerfd.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -36,21 +39,39 @@ namespace {
 
 fibonacci_sequence<10> fibonacci10;
 
+/** Number of io_uring submission queue entries. */
+constexpr unsigned RING_ENTRIES = 256;
+
+/** Number of receive buffers provided to io_uring. */
+constexpr std::uint16_t RING_BUFFER_COUNT = 128;
+
+/** Size of a single receive buffer provided to io_uring. */
+constexpr std::size_t RING_BUFFER_SIZE = 0x4000;
+
 } // namespace
 
-linux_async_worker_thread::linux_async_worker_thread(linux_async_client_pool &client_pool)
+linux_async_worker_thread::linux_async_worker_thread(linux_async_client_pool &client_pool, bool primary)
     : m_client_pool(client_pool)
+    , m_primary(primary)
     , m_stopping(true)
     , m_epoll(-1)
     , m_stop_event(-1)
+    , m_flush_timer(-1)
+    , m_flush_clients()
+    , m_flushing_clients()
+    , m_flush_armed(false)
+    , m_flush_mutex()
     , m_non_connected()
-    , m_current_connection()
-    , m_current_client()
-    , m_failed_attempts(0)
-    , m_last_connection_time()
+    , m_connecting(0)
+    , m_next_range(0)
+    , m_next_timer_tick()
     , m_min_addrs(0)
+    , m_limit(0)
+    , m_known_addrs()
+    , m_new_addrs()
+    , m_removed_addrs()
+    , m_new_addrs_mutex()
     , m_thread() {
-    memset(&m_last_connection_time, 0, sizeof(m_last_connection_time));
 }
 
 linux_async_worker_thread::~linux_async_worker_thread() {
@@ -82,17 +103,55 @@ void linux_async_worker_thread::start(size_t limit, std::vector<tcp_range> addrs
         throw ignite_error(error::code::INTERNAL, msg);
     }
 
+    if (m_flush_delay.count() > 0) {
+        m_flush_timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+        if (m_flush_timer < 0) {
+            std::string msg = get_last_system_error("Failed to create flush timer", "");
+            close(m_stop_event);
+            close(m_epoll);
+            throw ignite_error(error::code::INTERNAL, msg);
+        }
+
+        event.events = EPOLLIN;
+        event.data.ptr = &m_flush_timer;
+
+        res = epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_flush_timer, &event);
+        if (res < 0) {
+            std::string msg = get_last_system_error("Failed to add flush timer to epoll", "");
+            close(m_flush_timer);
+            m_flush_timer = -1;
+            close(m_stop_event);
+            close(m_epoll);
+            throw ignite_error(error::code::INTERNAL, msg);
+        }
+    }
+
+    // Connecting sockets, the stop event and the flush timer are still served by epoll, which is polled by the ring.
+    if (m_io_uring_enabled && linux_io_uring::is_supported()) {
+        try {
+            m_ring = std::make_unique<linux_io_uring>(RING_ENTRIES, RING_BUFFER_COUNT, RING_BUFFER_SIZE);
+            m_ring->prepare_poll(m_epoll, linux_io_uring::make_user_data(0, linux_io_uring::op_type::POLL));
+        } catch (const ignite_error &) {
+            // Fall back to epoll.
+            m_ring.reset();
+        }
+    }
+
+    m_events.resize(m_max_events);
+    m_flush_armed = false;
     m_stopping = false;
-    m_failed_attempts = 0;
-    m_non_connected = std::move(addrs);
+    m_known_addrs = addrs;
+    m_non_connected.clear();
+    for (auto &addr : addrs)
+        m_non_connected.emplace_back(std::move(addr));
 
-    m_current_connection.reset();
-    m_current_client.reset();
+    m_connecting = 0;
+    m_next_range = 0;
+    m_limit = limit;
 
-    if (!limit || limit > m_non_connected.size())
-        m_min_addrs = 0;
-    else
-        m_min_addrs = m_non_connected.size() - limit;
+    m_next_timer_tick = std::chrono::steady_clock::now() + async_handler::TIMER_TICK_INTERVAL;
+
+    update_min_addrs();
 
     m_thread = std::thread(&linux_async_worker_thread::run, this);
 }
@@ -111,11 +170,71 @@ void linux_async_worker_thread::stop() {
 
     m_thread.join();
 
+    stop_ring_clients();
+
+    if (m_flush_timer >= 0) {
+        close(m_flush_timer);
+        m_flush_timer = -1;
+    }
+
     close(m_stop_event);
     close(m_epoll);
 
+    // Clients which are still connecting are closed on destruction.
     m_non_connected.clear();
-    m_current_connection.reset();
+    m_known_addrs.clear();
+    m_connecting = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_flush_mutex);
+        m_flush_clients.clear();
+        m_flush_armed = false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_new_addrs_mutex);
+    m_new_addrs.clear();
+    m_removed_addrs.clear();
+}
+
+void linux_async_worker_thread::add_addresses(std::vector<tcp_range> addrs) {
+    std::lock_guard<std::mutex> lock(m_new_addrs_mutex);
+
+    // The latest change of an address wins.
+    for (const auto &addr : addrs)
+        m_removed_addrs.erase(std::remove(m_removed_addrs.begin(), m_removed_addrs.end(), addr), m_removed_addrs.end());
+
+    m_new_addrs.insert(m_new_addrs.end(), std::make_move_iterator(addrs.begin()), std::make_move_iterator(addrs.end()));
+}
+
+void linux_async_worker_thread::remove_addresses(const std::vector<tcp_range> &addrs) {
+    std::lock_guard<std::mutex> lock(m_new_addrs_mutex);
+
+    for (const auto &addr : addrs) {
+        m_new_addrs.erase(std::remove(m_new_addrs.begin(), m_new_addrs.end(), addr), m_new_addrs.end());
+        m_removed_addrs.push_back(addr);
+    }
+}
+
+void linux_async_worker_thread::schedule_flush(std::weak_ptr<linux_async_client> client) {
+    std::lock_guard<std::mutex> lock(m_flush_mutex);
+    m_flush_clients.push_back(std::move(client));
+
+    if (m_flush_armed || m_flush_timer < 0)
+        return;
+
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(m_flush_delay);
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(m_flush_delay - seconds);
+
+    itimerspec spec{};
+    spec.it_value.tv_sec = time_t(seconds.count());
+    spec.it_value.tv_nsec = long(nanoseconds.count());
+
+    int res = timerfd_settime(m_flush_timer, 0, &spec, nullptr);
+
+    (void) res;
+    assert(res == 0);
+
+    m_flush_armed = true;
 }
 
 void linux_async_worker_thread::run() {
@@ -125,32 +244,44 @@ void linux_async_worker_thread::run() {
         if (m_stopping)
             break;
 
-        handle_connection_events();
+        if (m_ring)
+            handle_ring_events();
+        else
+            handle_connection_events(calculate_poll_timeout());
+
+        handle_timer_tick();
     }
 }
 
 void linux_async_worker_thread::handle_new_connections() {
-    if (!should_initiate_new_connection())
-        return;
+    auto now = std::chrono::steady_clock::now();
+    auto count = m_non_connected.size();
+
+    // Ranges are visited round-robin, so with connection limit every range gets its turn.
+    for (size_t i = 0; i < count && should_initiate_new_connection(); ++i) {
+        auto idx = (m_next_range + i) % count;
+        auto &range = m_non_connected[idx];
+        if (range.client || now < range.next_attempt)
+            continue;
 
-    if (calculate_connection_timeout() > 0)
-        return;
+        initiate_connection(range);
+        m_next_range = idx + 1;
+    }
+}
 
+void linux_async_worker_thread::initiate_connection(non_connected_range &range) {
     addrinfo *addr = nullptr;
-    if (m_current_connection)
-        addr = m_current_connection->next();
+    if (range.connection)
+        addr = range.connection->next();
 
     if (!addr) {
-        // TODO: Use round-robin instead.
-        size_t idx = rand() % m_non_connected.size();
-        const tcp_range &range = m_non_connected.at(idx);
-
-        m_current_connection = std::make_unique<connecting_context>(range);
-        addr = m_current_connection->next();
+        range.connection = std::make_unique<connecting_context>(range.range);
+        addr = range.connection->next();
         if (!addr) {
-            m_current_connection.reset();
-            report_connection_error(end_point(), "Can not resolve a single address from range: " + range.to_string());
-            ++m_failed_attempts;
+            range.connection.reset();
+            report_connection_error(
+                end_point(), "Can not resolve a single address from range: " + range.range.to_string());
+            schedule_next_attempt(range);
             return;
         }
     }
@@ -159,63 +290,91 @@ void linux_async_worker_thread::handle_new_connections() {
     int socket_fd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
     if (SOCKET_ERROR == socket_fd) {
         report_connection_error(
-            m_current_connection->current_address(), "Socket creation failed: " + get_last_socket_error_message());
+            range.connection->current_address(), "Socket creation failed: " + get_last_socket_error_message());
+        schedule_next_attempt(range);
         return;
     }
 
     try_set_socket_options(socket_fd, linux_async_client::BUFFER_SIZE, true, true, true);
+    if (m_low_latency_sockets)
+        try_set_low_latency_options(socket_fd, m_busy_poll);
     bool success = set_non_blocking_mode(socket_fd, true);
     if (!success) {
-        report_connection_error(m_current_connection->current_address(),
+        report_connection_error(range.connection->current_address(),
             "Can not make non-blocking socket: " + get_last_socket_error_message());
+        close(socket_fd);
+        schedule_next_attempt(range);
         return;
     }
 
-    m_current_client = m_current_connection->to_client(socket_fd);
-    bool ok = m_current_client->start_monitoring(m_epoll);
+    range.client = range.connection->to_client(socket_fd);
+    bool ok = range.client->start_monitoring(m_epoll, m_edge_triggered);
     if (!ok)
         throw_last_system_error("Can not add file descriptor to epoll");
 
+    ++m_connecting;
+
     // Connect to server.
     int res = connect(socket_fd, addr->ai_addr, addr->ai_addrlen);
     if (SOCKET_ERROR == res) {
         int last_error = errno;
-
-        clock_gettime(CLOCK_MONOTONIC, &m_last_connection_time);
-
         if (last_error != EWOULDBLOCK && last_error != EINPROGRESS) {
             handle_connection_failed(
-                "Failed to establish connection with the host: " + get_socket_error_message(last_error));
+                range, "Failed to establish connection with the host: " + get_socket_error_message(last_error));
             return;
         }
     }
 }
 
-void linux_async_worker_thread::handle_connection_events() {
-    enum { MAX_EVENTS = 16 };
+std::vector<linux_async_worker_thread::non_connected_range>::iterator linux_async_worker_thread::find_connecting(
+    const linux_async_client *client) {
+    if (!m_connecting)
+        return m_non_connected.end();
 
-    epoll_event events[MAX_EVENTS];
+    return std::find_if(m_non_connected.begin(), m_non_connected.end(),
+        [client](const non_connected_range &range) { return range.client.get() == client; });
+}
 
-    int timeout = calculate_connection_timeout();
+void linux_async_worker_thread::handle_connection_events(int timeout) {
+    int res = 0;
+
+    // Spin before blocking, so the events coming shortly do not wait for the thread to wake up.
+    if (m_busy_poll.count() > 0 && timeout != 0) {
+        auto end = calculate_busy_poll_end(timeout);
+        do {
+            res = epoll_wait(m_epoll, m_events.data(), int(m_events.size()), 0);
+        } while (res == 0 && !m_stopping && std::chrono::steady_clock::now() < end);
+    }
 
-    int res = epoll_wait(m_epoll, events, MAX_EVENTS, timeout);
+    if (res == 0)
+        res = epoll_wait(m_epoll, m_events.data(), int(m_events.size()), timeout);
 
     if (res <= 0)
         return;
 
     for (int i = 0; i < res; ++i) {
-        epoll_event &current_event = events[i];
+        epoll_event &current_event = m_events[i];
+        if (current_event.data.ptr == &m_flush_timer) {
+            handle_flush();
+            continue;
+        }
+
         auto client = static_cast<linux_async_client *>(current_event.data.ptr);
         if (!client)
             continue;
 
-        if (client == m_current_client.get()) {
+        auto connecting = find_connecting(client);
+        if (connecting != m_non_connected.end()) {
             if (current_event.events & (EPOLLRDHUP | EPOLLERR)) {
-                handle_connection_failed("Can not establish connection");
+                handle_connection_failed(*connecting, "Can not establish connection");
                 continue;
             }
 
-            handle_connection_success(client);
+            handle_connection_success(connecting);
+
+            // The established connection is served with io_uring from now on.
+            if (m_ring)
+                continue;
         }
 
         if (current_event.events & (EPOLLRDHUP | EPOLLERR | EPOLLHUP)) {
@@ -224,13 +383,11 @@ void linux_async_worker_thread::handle_connection_events() {
         }
 
         if (current_event.events & EPOLLIN) {
-            auto msg = client->receive();
-            if (msg.empty()) {
+            bool ok = handle_receive(*client);
+            if (!ok) {
                 handle_connection_closed(client);
                 continue;
             }
-
-            m_client_pool.handle_message_received(client->id(), msg);
         }
 
         if (current_event.events & EPOLLOUT) {
@@ -245,68 +402,396 @@ void linux_async_worker_thread::handle_connection_events() {
     }
 }
 
+bool linux_async_worker_thread::handle_receive(linux_async_client &client) {
+    do {
+        bytes_view msg;
+        bool ok = client.receive(msg);
+        if (!ok)
+            return false;
+
+        if (msg.empty())
+            break;
+
+        m_client_pool.handle_message_received(client.id(), msg);
+    } while (m_edge_triggered);
+
+    return true;
+}
+
+void linux_async_worker_thread::handle_ring_events() {
+    int timeout = calculate_poll_timeout();
+
+    // Spin before blocking, so the completions coming shortly do not wait for the thread to wake up.
+    bool ready = false;
+    if (m_busy_poll.count() > 0 && timeout != 0) {
+        m_ring->submit();
+
+        auto end = calculate_busy_poll_end(timeout);
+        do {
+            ready = m_ring->has_completions();
+        } while (!ready && !m_stopping && std::chrono::steady_clock::now() < end);
+    }
+
+    if (!ready)
+        m_ring->wait(timeout);
+
+    m_ring->for_each_completion([this](std::uint64_t user_data, std::int32_t res, std::uint32_t flags) {
+        handle_ring_completion(user_data, res, flags);
+    });
+}
+
+void linux_async_worker_thread::handle_ring_completion(std::uint64_t user_data, std::int32_t res, std::uint32_t flags) {
+    auto id = linux_io_uring::get_id(user_data);
+    switch (linux_io_uring::get_op(user_data)) {
+        case linux_io_uring::op_type::POLL:
+            handle_connection_events(0);
+            m_ring->prepare_poll(m_epoll, user_data);
+            break;
+
+        case linux_io_uring::op_type::RECV:
+            handle_ring_receive(id, res, flags);
+            break;
+
+        case linux_io_uring::op_type::SEND:
+            handle_ring_send(id, res);
+            break;
+
+        case linux_io_uring::op_type::PROVIDE:
+            // Buffers which failed to be provided are lost, the rest are enough to keep receiving.
+            break;
+    }
+}
+
+void linux_async_worker_thread::handle_ring_receive(std::uint64_t id, std::int32_t res, std::uint32_t flags) {
+    auto it = m_ring_clients.find(id);
+    bool has_buffer = linux_io_uring::has_buffer(flags);
+    if (it == m_ring_clients.end()) {
+        if (has_buffer)
+            m_ring->recycle_buffer(linux_io_uring::get_buffer_id(flags));
+
+        return;
+    }
+
+    auto &entry = it->second;
+    if (has_buffer) {
+        auto buffer_id = linux_io_uring::get_buffer_id(flags);
+        if (res > 0 && !entry.closed) {
+            entry.client->rearm_quick_ack();
+            m_client_pool.handle_message_received(id, {m_ring->get_buffer(buffer_id), std::size_t(res)});
+        }
+
+        m_ring->recycle_buffer(buffer_id);
+    }
+
+    if (linux_io_uring::has_more(flags))
+        return;
+
+    entry.receiving = false;
+    if (entry.closed) {
+        try_release_ring_client(it);
+        return;
+    }
+
+    // The kernel stops the multishot receive when it runs out of buffers. They are recycled by now.
+    if (res > 0 || res == -ENOBUFS) {
+        entry.receiving = entry.client->prepare_receive();
+        if (entry.receiving)
+            return;
+    }
+
+    close_ring_client(it);
+}
+
+void linux_async_worker_thread::handle_ring_send(std::uint64_t id, std::int32_t res) {
+    auto it = m_ring_clients.find(id);
+    if (it == m_ring_clients.end())
+        return;
+
+    auto &entry = it->second;
+    bool ok = entry.client->process_sent(res);
+    if (entry.closed) {
+        try_release_ring_client(it);
+        return;
+    }
+
+    if (!ok) {
+        close_ring_client(it);
+        return;
+    }
+
+    m_client_pool.handle_message_sent(id);
+}
+
+void linux_async_worker_thread::close_ring_client(std::unordered_map<std::uint64_t, ring_client>::iterator it) {
+    auto &entry = it->second;
+    if (entry.closed)
+        return;
+
+    entry.closed = true;
+
+    // Shutdown makes the operations in progress complete.
+    entry.client->shutdown(std::nullopt);
+
+    if (is_known_address(entry.client->get_range()))
+        m_non_connected.emplace_back(entry.client->get_range());
+
+    m_client_pool.close_and_release(entry.client->id(), std::nullopt);
+
+    try_release_ring_client(it);
+}
+
+void linux_async_worker_thread::try_release_ring_client(std::unordered_map<std::uint64_t, ring_client>::iterator it) {
+    auto &entry = it->second;
+    if (!entry.receiving && !entry.client->is_sending())
+        m_ring_clients.erase(it);
+}
+
+void linux_async_worker_thread::stop_ring_clients() {
+    if (!m_ring)
+        return;
+
+    for (auto &[_, entry] : m_ring_clients) {
+        entry.closed = true;
+        entry.client->shutdown(std::nullopt);
+    }
+
+    // The operations complete promptly once the sockets are shut down. Do not wait forever anyway.
+    for (int attempt = 0; attempt < 10 && !m_ring_clients.empty(); ++attempt) {
+        m_ring->wait(100);
+        m_ring->for_each_completion([this](std::uint64_t user_data, std::int32_t res, std::uint32_t flags) {
+            switch (linux_io_uring::get_op(user_data)) {
+                case linux_io_uring::op_type::RECV:
+                    handle_ring_receive(linux_io_uring::get_id(user_data), res, flags);
+                    break;
+
+                case linux_io_uring::op_type::SEND:
+                    handle_ring_send(linux_io_uring::get_id(user_data), res);
+                    break;
+
+                default:
+                    break;
+            }
+        });
+    }
+
+    m_ring_clients.clear();
+    m_ring.reset();
+}
+
+void linux_async_worker_thread::handle_flush() {
+    std::uint64_t expirations = 0;
+    ssize_t res = read(m_flush_timer, &expirations, sizeof(expirations));
+    (void) res;
+
+    {
+        std::lock_guard<std::mutex> lock(m_flush_mutex);
+        m_flush_clients.swap(m_flushing_clients);
+        m_flush_armed = false;
+    }
+
+    for (auto &weak_client : m_flushing_clients) {
+        auto client = weak_client.lock();
+        if (!client || client->is_closed())
+            continue;
+
+        bool ok = client->flush();
+        if (!ok)
+            handle_connection_closed(client.get());
+    }
+
+    m_flushing_clients.clear();
+}
+
+void linux_async_worker_thread::handle_timer_tick() {
+    auto now = std::chrono::steady_clock::now();
+    if (now < m_next_timer_tick)
+        return;
+
+    m_next_timer_tick = now + async_handler::TIMER_TICK_INTERVAL;
+
+    handle_new_addresses();
+
+    if (m_primary)
+        m_client_pool.handle_timer_tick();
+}
+
+void linux_async_worker_thread::handle_new_addresses() {
+    std::vector<tcp_range> addrs;
+    std::vector<tcp_range> removed;
+    {
+        std::lock_guard<std::mutex> lock(m_new_addrs_mutex);
+        addrs.swap(m_new_addrs);
+        removed.swap(m_removed_addrs);
+    }
+
+    if (addrs.empty() && removed.empty())
+        return;
+
+    for (const auto &addr : removed) {
+        m_known_addrs.erase(std::remove(m_known_addrs.begin(), m_known_addrs.end(), addr), m_known_addrs.end());
+
+        for (auto it = m_non_connected.begin(); it != m_non_connected.end();) {
+            if (it->range != addr) {
+                ++it;
+                continue;
+            }
+
+            if (it->client) {
+                it->client->stop_monitoring();
+                it->client->close();
+                --m_connecting;
+            }
+
+            it = m_non_connected.erase(it);
+        }
+    }
+
+    // Only addresses known before are skipped, as an address may be listed several times.
+    auto known_end = m_known_addrs.size();
+    for (auto &addr : addrs) {
+        auto known_last = m_known_addrs.begin() + std::ptrdiff_t(known_end);
+        if (std::find(m_known_addrs.begin(), known_last, addr) != known_last)
+            continue;
+
+        m_known_addrs.push_back(addr);
+        m_non_connected.emplace_back(std::move(addr));
+    }
+
+    update_min_addrs();
+}
+
+void linux_async_worker_thread::update_min_addrs() {
+    // Connecting stops when the number of non-connected addresses drops to the minimum.
+    if (!m_limit || m_limit > m_known_addrs.size())
+        m_min_addrs = 0;
+    else
+        m_min_addrs = m_known_addrs.size() - m_limit;
+}
+
 void linux_async_worker_thread::report_connection_error(const end_point &addr, std::string msg) {
     ignite_error err(error::code::CONNECTION, std::move(msg));
     m_client_pool.handle_connection_error(addr, err);
 }
 
-void linux_async_worker_thread::handle_connection_failed(std::string msg) {
-    assert(m_current_client);
+void linux_async_worker_thread::handle_connection_failed(non_connected_range &range, std::string msg) {
+    assert(range.client);
 
-    m_current_client->stop_monitoring();
-    m_current_client->close();
+    range.client->stop_monitoring();
+    range.client->close();
 
-    report_connection_error(m_current_client->address(), std::move(msg));
+    report_connection_error(range.client->address(), std::move(msg));
 
-    m_current_client.reset();
-    ++m_failed_attempts;
+    range.client.reset();
+    --m_connecting;
+
+    schedule_next_attempt(range);
+}
+
+void linux_async_worker_thread::schedule_next_attempt(non_connected_range &range) {
+    ++range.failed_attempts;
+
+    auto backoff = std::chrono::seconds(fibonacci10.get_value(range.failed_attempts));
+    range.next_attempt = std::chrono::steady_clock::now() + backoff;
 }
 
 void linux_async_worker_thread::handle_connection_closed(linux_async_client *client) {
+    if (m_ring) {
+        auto it = m_ring_clients.find(client->id());
+        if (it != m_ring_clients.end()) {
+            close_ring_client(it);
+            return;
+        }
+    }
+
     client->stop_monitoring();
 
-    m_non_connected.push_back(client->get_range());
+    if (is_known_address(client->get_range()))
+        m_non_connected.emplace_back(client->get_range());
 
     m_client_pool.close_and_release(client->id(), std::nullopt);
 }
 
-void linux_async_worker_thread::handle_connection_success(linux_async_client *client) {
-    m_non_connected.erase(std::find(m_non_connected.begin(), m_non_connected.end(), client->get_range()));
+void linux_async_worker_thread::handle_connection_success(std::vector<non_connected_range>::iterator range) {
+    auto client = std::move(range->client);
 
-    m_client_pool.add_client(std::move(m_current_client));
+    m_non_connected.erase(range);
+    --m_connecting;
 
-    m_current_client.reset();
-    m_current_connection.reset();
+    // Should be set before the handshake is sent by the pool handler.
+    if (m_flush_timer >= 0)
+        client->set_write_combining(this, m_flush_threshold);
 
-    m_failed_attempts = 0;
+    client->set_low_latency(m_busy_poll.count() > 0, m_low_latency_sockets);
+
+    if (!m_ring) {
+        m_client_pool.add_client(std::move(client));
+        return;
+    }
+
+    client->stop_monitoring();
+    client->set_io_uring(m_ring.get());
 
-    clock_gettime(CLOCK_MONOTONIC, &m_last_connection_time);
+    bool added = m_client_pool.add_client(client);
+    if (!added)
+        return;
+
+    auto it = m_ring_clients.emplace(client->id(), ring_client{client}).first;
+    it->second.receiving = client->prepare_receive();
+    if (!it->second.receiving)
+        close_ring_client(it);
+}
+
+int linux_async_worker_thread::calculate_poll_timeout() const {
+    int timeout = calculate_connection_timeout();
+    int tick_timeout = calculate_timer_tick_timeout();
+    if (timeout < 0 || tick_timeout < timeout)
+        timeout = tick_timeout;
+
+    return timeout;
+}
+
+std::chrono::steady_clock::time_point linux_async_worker_thread::calculate_busy_poll_end(int timeout) const {
+    auto duration = m_busy_poll;
+    if (timeout >= 0)
+        duration = std::min(duration, std::chrono::microseconds(std::chrono::milliseconds(timeout)));
+
+    return std::chrono::steady_clock::now() + duration;
 }
 
 int linux_async_worker_thread::calculate_connection_timeout() const {
     if (!should_initiate_new_connection())
         return -1;
 
-    if (m_last_connection_time.tv_sec == 0)
-        return 0;
+    auto now = std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> earliest;
+    for (const auto &range : m_non_connected) {
+        if (range.client)
+            continue;
 
-    int timeout = int(fibonacci10.get_value(m_failed_attempts) * 1000);
+        if (range.next_attempt <= now)
+            return 0;
 
-    timespec now{};
-    clock_gettime(CLOCK_MONOTONIC, &now);
+        if (!earliest || range.next_attempt < *earliest)
+            earliest = range.next_attempt;
+    }
+
+    if (!earliest)
+        return -1;
 
-    int passed = int(
-        (now.tv_sec - m_last_connection_time.tv_sec) * 1000 + (now.tv_nsec - m_last_connection_time.tv_nsec) / 1000000);
+    return int(std::chrono::ceil<std::chrono::milliseconds>(*earliest - now).count());
+}
 
-    timeout -= passed;
-    if (timeout < 0)
-        timeout = 0;
+int linux_async_worker_thread::calculate_timer_tick_timeout() const {
+    auto left = m_next_timer_tick - std::chrono::steady_clock::now();
+    if (left <= std::chrono::steady_clock::duration::zero())
+        return 0;
 
-    return timeout;
+    // Round up, so the thread does not wake up right before the tick.
+    return int(std::chrono::ceil<std::chrono::milliseconds>(left).count());
 }
 
 bool linux_async_worker_thread::should_initiate_new_connection() const {
-    return !m_current_client && m_non_connected.size() > m_min_addrs;
+    return m_non_connected.size() - m_connecting > m_min_addrs;
 }
 
 } // namespace ignite::network::detail
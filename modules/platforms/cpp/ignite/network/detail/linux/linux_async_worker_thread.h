@@ -21,13 +21,19 @@
 #include "ignite/network/async_handler.h"
 #include "ignite/network/detail/linux/connecting_context.h"
 #include "ignite/network/detail/linux/linux_async_client.h"
+#include "ignite/network/detail/linux/linux_io_uring.h"
 #include "ignite/network/tcp_range.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
-#include <ctime>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/epoll.h>
 
 namespace ignite::network::detail {
 
@@ -39,9 +45,12 @@ class linux_async_client_pool;
 class linux_async_worker_thread {
 public:
     /**
-     * Default constructor.
+     * Constructor.
+     *
+     * @param client_pool Client pool.
+     * @param primary Whether the thread notifies the pool about timer ticks. Exactly one thread of a pool does.
      */
-    explicit linux_async_worker_thread(linux_async_client_pool &client_pool);
+    linux_async_worker_thread(linux_async_client_pool &client_pool, bool primary);
 
     /**
      * Destructor.
@@ -61,21 +70,236 @@ public:
      */
     void stop();
 
+    /**
+     * Add addresses to connect to. Picked up by the thread on the next timer tick.
+     *
+     * @param addrs Addresses.
+     */
+    void add_addresses(std::vector<tcp_range> addrs);
+
+    /**
+     * Remove addresses. Picked up by the thread on the next timer tick. Connection attempts to the addresses are
+     * abandoned, and the connections established to them are not re-established once closed.
+     *
+     * @param addrs Addresses.
+     */
+    void remove_addresses(const std::vector<tcp_range> &addrs);
+
+    /**
+     * Set write combining parameters. Should be called before the thread is started.
+     *
+     * @param delay Time the packets are held back before the flush. Zero means write combining is disabled.
+     * @param threshold Size of the held back packets of a connection which triggers the flush right away.
+     */
+    void set_write_combining(std::chrono::microseconds delay, std::size_t threshold) {
+        m_flush_delay = delay;
+        m_flush_threshold = threshold;
+    }
+
+    /**
+     * Set event polling parameters. Should be called before the thread is started.
+     *
+     * @param edge_triggered Whether to use edge-triggered notifications.
+     * @param max_events Maximum number of events handled per single poll.
+     */
+    void set_event_polling(bool edge_triggered, std::size_t max_events) {
+        m_edge_triggered = edge_triggered;
+        m_max_events = std::max(max_events, std::size_t(1));
+    }
+
+    /**
+     * Set whether established connections are served with io_uring. Epoll is used if io_uring is not supported
+     * by the system. Should be called before the thread is started.
+     *
+     * @param enabled Whether io_uring is used.
+     */
+    void set_io_uring_enabled(bool enabled) { m_io_uring_enabled = enabled; }
+
+    /**
+     * Set busy polling parameters. Should be called before the thread is started.
+     *
+     * @param duration Time to poll for events without blocking before blocking. Zero means busy polling is
+     *  disabled.
+     * @param socket_options Whether to set the low latency socket options.
+     */
+    void set_busy_poll(std::chrono::microseconds duration, bool socket_options) {
+        m_busy_poll = duration;
+        m_low_latency_sockets = socket_options;
+    }
+
+    /**
+     * Schedule flush of the packets held back by the client. The flush happens when the flush delay passes since
+     * the first of the currently scheduled flushes, so it is shared by all the clients of the thread.
+     *
+     * Can be called from external threads.
+     *
+     * @param client Client.
+     */
+    void schedule_flush(std::weak_ptr<linux_async_client> client);
+
 private:
+    /**
+     * Address range which is not connected yet.
+     */
+    struct non_connected_range {
+        /**
+         * Constructor.
+         *
+         * @param range Address range.
+         */
+        explicit non_connected_range(tcp_range range)
+            : range(std::move(range)) {}
+
+        /** Address range. */
+        tcp_range range;
+
+        /** Addresses of the range which are tried one after another. Null if the range was not resolved yet. */
+        std::unique_ptr<connecting_context> connection;
+
+        /** Client which is currently in connecting process. Null if there is no attempt in progress. */
+        std::shared_ptr<linux_async_client> client;
+
+        /** Failed connection attempts. */
+        size_t failed_attempts{0};
+
+        /** Time of the next connection attempt. */
+        std::chrono::steady_clock::time_point next_attempt{};
+    };
+
+    /**
+     * Established connection served with io_uring.
+     */
+    struct ring_client {
+        /** Client. Kept alive until there are no operations in progress. */
+        std::shared_ptr<linux_async_client> client;
+
+        /** Whether the multishot receive is active. */
+        bool receiving{false};
+
+        /** Whether the connection is closed. */
+        bool closed{false};
+    };
+
     /**
      * Run thread.
      */
     void run();
 
     /**
-     * Initiate new connection process if needed.
+     * Initiate new connection process for every range which is due for a connection attempt, if needed.
      */
     void handle_new_connections();
 
+    /**
+     * Initiate connection to the next address of the range.
+     *
+     * @param range Range to connect to.
+     */
+    void initiate_connection(non_connected_range &range);
+
+    /**
+     * Find range which the connecting client belongs to.
+     *
+     * @param client Client instance.
+     * @return Range iterator, or end iterator if the client is not in connecting process.
+     */
+    std::vector<non_connected_range>::iterator find_connecting(const linux_async_client *client);
+
     /**
      * Handle epoll events.
+     *
+     * @param timeout Timeout in milliseconds. Negative value means no timeout.
+     */
+    void handle_connection_events(int timeout);
+
+    /**
+     * Handle io_uring completions. Epoll events are handled when the ring reports that epoll has events.
+     */
+    void handle_ring_events();
+
+    /**
+     * Handle io_uring completion.
+     *
+     * @param user_data User data of the completed operation.
+     * @param res Result.
+     * @param flags Flags.
+     */
+    void handle_ring_completion(std::uint64_t user_data, std::int32_t res, std::uint32_t flags);
+
+    /**
+     * Handle io_uring receive completion.
+     *
+     * @param id Client ID.
+     * @param res Number of received bytes or negated error code.
+     * @param flags Flags.
+     */
+    void handle_ring_receive(std::uint64_t id, std::int32_t res, std::uint32_t flags);
+
+    /**
+     * Handle io_uring send completion.
+     *
+     * @param id Client ID.
+     * @param res Number of sent bytes or negated error code.
+     */
+    void handle_ring_send(std::uint64_t id, std::int32_t res);
+
+    /**
+     * Close the connection served with io_uring. The client is released once its operations complete.
+     *
+     * @param it Client iterator.
+     */
+    void close_ring_client(std::unordered_map<std::uint64_t, ring_client>::iterator it);
+
+    /**
+     * Release the closed client if it has no operations in progress.
+     *
+     * @param it Client iterator.
+     */
+    void try_release_ring_client(std::unordered_map<std::uint64_t, ring_client>::iterator it);
+
+    /**
+     * Shut down the connections served with io_uring and wait until their operations complete.
+     */
+    void stop_ring_clients();
+
+    /**
+     * Receive data available on the client socket and pass it to the pool. With edge-triggered notifications the
+     * socket is read until there is no more data available.
+     *
+     * @param client Client instance.
+     * @return @c true on success and @c false if the connection is closed or failed.
+     */
+    bool handle_receive(linux_async_client &client);
+
+    /**
+     * Flush the packets of the clients which scheduled the flush.
      */
-    void handle_connection_events();
+    void handle_flush();
+
+    /**
+     * Notify the pool about a timer tick if the tick interval has passed.
+     */
+    void handle_timer_tick();
+
+    /**
+     * Move the added addresses to the addresses to connect to, and drop the removed ones.
+     */
+    void handle_new_addresses();
+
+    /**
+     * Check whether the address is known, so the connection to it should be re-established once closed.
+     *
+     * @param addr Address.
+     * @return @c true if the address is known.
+     */
+    [[nodiscard]] bool is_known_address(const tcp_range &addr) const {
+        return std::find(m_known_addrs.begin(), m_known_addrs.end(), addr) != m_known_addrs.end();
+    }
+
+    /**
+     * Update the minimal number of addresses after the known addresses changed.
+     */
+    void update_min_addrs();
 
     /**
      * Handle network error during connection establishment.
@@ -88,9 +312,17 @@ private:
     /**
      * Handle failed connection.
      *
+     * @param range Range which the connection was established to.
      * @param msg Error message.
      */
-    void handle_connection_failed(std::string msg);
+    void handle_connection_failed(non_connected_range &range, std::string msg);
+
+    /**
+     * Postpone the next connection attempt to the range according to the number of failed attempts.
+     *
+     * @param range Range.
+     */
+    static void schedule_next_attempt(non_connected_range &range);
 
     /**
      * Handle network error on established connection.
@@ -102,17 +334,39 @@ private:
     /**
      * Handle successfully established connection.
      *
-     * @param client Client instance.
+     * @param range Range which the connection was established to.
+     */
+    void handle_connection_success(std::vector<non_connected_range>::iterator range);
+
+    /**
+     * Calculate the poll timeout, so the thread wakes up for the next connection attempt or timer tick.
+     *
+     * @return Timeout in milliseconds.
+     */
+    [[nodiscard]] int calculate_poll_timeout() const;
+
+    /**
+     * Calculate the time busy polling ends at. Busy polling never lasts longer than the poll timeout.
+     *
+     * @param timeout Poll timeout in milliseconds. Negative value means no timeout.
+     * @return Busy polling end time.
      */
-    void handle_connection_success(linux_async_client *client);
+    [[nodiscard]] std::chrono::steady_clock::time_point calculate_busy_poll_end(int timeout) const;
 
     /**
-     * Calculate connection timeout.
+     * Calculate time left until the earliest connection attempt.
      *
-     * @return Connection timeout.
+     * @return Timeout in milliseconds, or -1 if no new connection should be initiated.
      */
     [[nodiscard]] int calculate_connection_timeout() const;
 
+    /**
+     * Calculate time left until the next timer tick.
+     *
+     * @return Timeout in milliseconds.
+     */
+    [[nodiscard]] int calculate_timer_tick_timeout() const;
+
     /**
      * Check whether new connection should be initiated.
      *
@@ -123,6 +377,9 @@ private:
     /** Client pool. */
     linux_async_client_pool &m_client_pool;
 
+    /** Whether the thread notifies the pool about timer ticks. */
+    const bool m_primary;
+
     /** Flag indicating that thread is stopping. */
     volatile bool m_stopping;
 
@@ -132,24 +389,81 @@ private:
     /** Stop event file descriptor. */
     int m_stop_event;
 
-    /** Addresses to use for connection establishment. */
-    std::vector<tcp_range> m_non_connected;
+    /** Whether edge-triggered notifications are used. */
+    bool m_edge_triggered{false};
+
+    /** Maximum number of events handled per single poll. */
+    std::size_t m_max_events{16};
+
+    /** Events returned by the poll. */
+    std::vector<epoll_event> m_events;
+
+    /** Whether io_uring is requested. */
+    bool m_io_uring_enabled{false};
 
-    /** Connection which is currently in connecting process. */
-    std::unique_ptr<connecting_context> m_current_connection;
+    /** Busy polling duration. Zero means busy polling is disabled. */
+    std::chrono::microseconds m_busy_poll{0};
 
-    /** Currently connected client. */
-    std::shared_ptr<linux_async_client> m_current_client;
+    /** Whether the low latency socket options are set. */
+    bool m_low_latency_sockets{false};
 
-    /** Failed connection attempts. */
-    size_t m_failed_attempts;
+    /** Ring serving the established connections. Null if epoll is used. */
+    std::unique_ptr<linux_io_uring> m_ring;
 
-    /** Last connection time. */
-    timespec m_last_connection_time;
+    /** Established connections served with io_uring, by ID. */
+    std::unordered_map<std::uint64_t, ring_client> m_ring_clients;
+
+    /** Flush timer file descriptor. -1 if write combining is disabled. */
+    int m_flush_timer;
+
+    /** Write combining flush delay. Zero means write combining is disabled. */
+    std::chrono::microseconds m_flush_delay{0};
+
+    /** Size of the held back packets of a connection which triggers the flush right away. */
+    std::size_t m_flush_threshold{0};
+
+    /** Clients which scheduled the flush. */
+    std::vector<std::weak_ptr<linux_async_client>> m_flush_clients;
+
+    /** Clients which are being flushed. Kept to reuse the memory. */
+    std::vector<std::weak_ptr<linux_async_client>> m_flushing_clients;
+
+    /** Whether the flush timer is armed. Protected by m_flush_mutex. */
+    bool m_flush_armed;
+
+    /** Flush mutex. */
+    std::mutex m_flush_mutex;
+
+    /** Addresses to use for connection establishment. */
+    std::vector<non_connected_range> m_non_connected;
+
+    /** Number of ranges with connection attempt in progress. */
+    size_t m_connecting;
+
+    /** Position in the non-connected ranges to start the next round of connection attempts from. */
+    size_t m_next_range;
+
+    /** Time of the next timer tick. */
+    std::chrono::steady_clock::time_point m_next_timer_tick;
 
     /** Minimal number of addresses. */
     size_t m_min_addrs;
 
+    /** Connection limit. Zero means limit is disabled. */
+    size_t m_limit;
+
+    /** Known addresses, both connected and not. */
+    std::vector<tcp_range> m_known_addrs;
+
+    /** Added addresses which were not picked up by the thread yet. */
+    std::vector<tcp_range> m_new_addrs;
+
+    /** Removed addresses which were not picked up by the thread yet. */
+    std::vector<tcp_range> m_removed_addrs;
+
+    /** New and removed addresses mutex. */
+    std::mutex m_new_addrs_mutex;
+
     /** Thread. */
     std::thread m_thread;
 };
@@ -0,0 +1,489 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "linux_io_uring.h"
+
+#include "../utils.h"
+
+#include <ignite/common/ignite_error.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#if __has_include(<linux/io_uring.h>)
+# include <linux/io_uring.h>
+#endif
+
+// Multishot receive is the latest of the used features, the kernel headers which define it have all the others.
+#ifdef IORING_RECV_MULTISHOT
+# define IGNITE_HAVE_IO_URING 1
+#endif
+
+#ifdef IGNITE_HAVE_IO_URING
+# include <poll.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace ignite::network::detail {
+
+#ifdef IGNITE_HAVE_IO_URING
+
+namespace {
+
+/** Group of the provided receive buffers. */
+constexpr std::uint16_t BUFFER_GROUP = 0;
+
+int io_uring_setup(unsigned entries, io_uring_params *params) {
+    return int(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags, const void *arg, size_t size) {
+    return int(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, size));
+}
+
+int io_uring_register(int fd, unsigned opcode, const void *arg, unsigned nr_args) {
+    return int(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+/**
+ * Check whether the ring supports the opcodes used by it.
+ *
+ * @param fd Ring file descriptor.
+ * @return @c true if supported.
+ */
+bool check_opcodes(int fd) {
+    constexpr std::uint8_t used_ops[] = {
+        IORING_OP_POLL_ADD, IORING_OP_RECV, IORING_OP_SENDMSG, IORING_OP_PROVIDE_BUFFERS};
+
+    constexpr unsigned probe_ops = IORING_OP_PROVIDE_BUFFERS + 1;
+    std::vector<std::byte> probe_mem(sizeof(io_uring_probe) + probe_ops * sizeof(io_uring_probe_op));
+    auto probe = reinterpret_cast<io_uring_probe *>(probe_mem.data());
+
+    if (io_uring_register(fd, IORING_REGISTER_PROBE, probe, probe_ops) < 0)
+        return false;
+
+    return std::all_of(std::begin(used_ops), std::end(used_ops), [probe](std::uint8_t op) {
+        return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+    });
+}
+
+/**
+ * Check whether multishot receive with provided buffers works. It has no opcode to probe, older kernels complete
+ * such a request with an error.
+ *
+ * @return @c true if supported.
+ */
+bool check_multishot_recv() {
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0)
+        return false;
+
+    bool supported = false;
+    try {
+        linux_io_uring ring(4, 1, 64);
+        auto user_data = linux_io_uring::make_user_data(1, linux_io_uring::op_type::RECV);
+
+        char data = 0;
+        if (ring.prepare_recv(fds[0], user_data) && ring.submit() && ::send(fds[1], &data, 1, 0) == 1) {
+            ring.wait(1000);
+            ring.for_each_completion([&](std::uint64_t cqe_data, std::int32_t res, std::uint32_t flags) {
+                if (cqe_data == user_data)
+                    supported = res > 0 && linux_io_uring::has_buffer(flags) && linux_io_uring::has_more(flags);
+            });
+        }
+    } catch (const ignite_error &) {
+        supported = false;
+    }
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    return supported;
+}
+
+/**
+ * Check whether the system supports everything used by the ring.
+ *
+ * @return @c true if supported.
+ */
+bool check_support() {
+    io_uring_params params{};
+    int fd = io_uring_setup(2, &params);
+    if (fd < 0)
+        return false;
+
+    bool supported = (params.features & IORING_FEAT_EXT_ARG) && (params.features & IORING_FEAT_NODROP)
+        && (params.features & IORING_FEAT_CQE_SKIP) && check_opcodes(fd);
+
+    ::close(fd);
+
+    return supported && check_multishot_recv();
+}
+
+} // namespace
+
+bool linux_io_uring::has_buffer(std::uint32_t flags) {
+    return flags & IORING_CQE_F_BUFFER;
+}
+
+std::uint16_t linux_io_uring::get_buffer_id(std::uint32_t flags) {
+    return std::uint16_t(flags >> IORING_CQE_BUFFER_SHIFT);
+}
+
+bool linux_io_uring::has_more(std::uint32_t flags) {
+    return flags & IORING_CQE_F_MORE;
+}
+
+bool linux_io_uring::is_supported() {
+    static const bool supported = check_support();
+
+    return supported;
+}
+
+linux_io_uring::linux_io_uring(unsigned entries, std::uint16_t buffer_count, std::size_t buffer_size) {
+    io_uring_params params{};
+    m_fd = io_uring_setup(entries, &params);
+    if (m_fd < 0)
+        throw_last_system_error("Failed to create io_uring instance");
+
+    try {
+        m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap)
+            m_sq_ring_size = m_cq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size);
+
+        m_sq_ring = mmap(nullptr, m_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+            IORING_OFF_SQ_RING);
+        if (m_sq_ring == MAP_FAILED) {
+            m_sq_ring = nullptr;
+            throw_last_system_error("Failed to map io_uring submission queue");
+        }
+
+        if (single_mmap)
+            m_cq_ring = m_sq_ring;
+        else {
+            m_cq_ring = mmap(nullptr, m_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd,
+                IORING_OFF_CQ_RING);
+            if (m_cq_ring == MAP_FAILED) {
+                m_cq_ring = nullptr;
+                throw_last_system_error("Failed to map io_uring completion queue");
+            }
+        }
+
+        void *sqes = mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+            throw_last_system_error("Failed to map io_uring submission queue entries");
+
+        m_sqes = static_cast<io_uring_sqe *>(sqes);
+        m_sq_entries = params.sq_entries;
+
+        auto sq_ring = static_cast<std::byte *>(m_sq_ring);
+        m_sq_head = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.head);
+        m_sq_tail = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.tail);
+        m_sq_mask = *reinterpret_cast<unsigned *>(sq_ring + params.sq_off.ring_mask);
+
+        // Entries are always used in order, so the indirection array maps every slot to itself.
+        auto sq_array = reinterpret_cast<unsigned *>(sq_ring + params.sq_off.array);
+        for (unsigned i = 0; i < m_sq_entries; ++i)
+            sq_array[i] = i;
+
+        auto cq_ring = static_cast<std::byte *>(m_cq_ring);
+        m_cq_head = reinterpret_cast<unsigned *>(cq_ring + params.cq_off.head);
+        m_cq_tail = reinterpret_cast<unsigned *>(cq_ring + params.cq_off.tail);
+        m_cq_mask = *reinterpret_cast<unsigned *>(cq_ring + params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe *>(cq_ring + params.cq_off.cqes);
+
+        m_buffer_count = buffer_count;
+        m_buffer_size = buffer_size;
+        m_buffers.resize(buffer_count * buffer_size);
+
+        // Buffer rings are not used: registration succeeds on some kernels which then fail to select a buffer.
+        if (!prepare_provide_buffers(0, buffer_count) || !submit())
+            throw_last_system_error("Failed to provide io_uring buffers");
+    } catch (...) {
+        release();
+
+        throw;
+    }
+}
+
+linux_io_uring::~linux_io_uring() {
+    release();
+}
+
+void linux_io_uring::release() {
+    if (m_sqes) {
+        munmap(m_sqes, m_sq_entries * sizeof(io_uring_sqe));
+        m_sqes = nullptr;
+    }
+
+    if (m_cq_ring && m_cq_ring != m_sq_ring)
+        munmap(m_cq_ring, m_cq_ring_size);
+    m_cq_ring = nullptr;
+
+    if (m_sq_ring) {
+        munmap(m_sq_ring, m_sq_ring_size);
+        m_sq_ring = nullptr;
+    }
+
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+bool linux_io_uring::prepare_poll(int fd, std::uint64_t user_data) {
+    std::lock_guard<std::mutex> lock(m_sq_mutex);
+
+    auto sqe = get_sqe_locked();
+    if (!sqe)
+        return false;
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = user_data;
+
+    push_sqe_locked();
+
+    return true;
+}
+
+bool linux_io_uring::prepare_recv(int fd, std::uint64_t user_data) {
+    std::lock_guard<std::mutex> lock(m_sq_mutex);
+
+    auto sqe = get_sqe_locked();
+    if (!sqe)
+        return false;
+
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->user_data = user_data;
+
+    push_sqe_locked();
+
+    return true;
+}
+
+bool linux_io_uring::prepare_sendmsg(int fd, const msghdr *msg, std::uint64_t user_data) {
+    std::lock_guard<std::mutex> lock(m_sq_mutex);
+
+    auto sqe = get_sqe_locked();
+    if (!sqe)
+        return false;
+
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<std::uint64_t>(msg);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = user_data;
+
+    push_sqe_locked();
+
+    return true;
+}
+
+bool linux_io_uring::submit() {
+    std::lock_guard<std::mutex> lock(m_sq_mutex);
+
+    return submit_locked();
+}
+
+void linux_io_uring::wait(int timeout) {
+    submit();
+
+    __kernel_timespec ts{};
+    io_uring_getevents_arg arg{};
+    arg.sigmask_sz = _NSIG / 8;
+    if (timeout >= 0) {
+        ts.tv_sec = timeout / 1000;
+        ts.tv_nsec = (timeout % 1000) * 1000000LL;
+        arg.ts = reinterpret_cast<std::uint64_t>(&ts);
+    }
+
+    // Errors, including the timeout and the interruption, are not interesting: completions are checked anyway.
+    io_uring_enter(m_fd, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+}
+
+bool linux_io_uring::has_completions() const {
+    return *m_cq_head != __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+}
+
+void linux_io_uring::for_each_completion(
+    const std::function<void(std::uint64_t, std::int32_t, std::uint32_t)> &handler) {
+    unsigned head = *m_cq_head;
+    unsigned tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail) {
+        const io_uring_cqe &cqe = m_cqes[head & m_cq_mask];
+        handler(cqe.user_data, cqe.res, cqe.flags);
+
+        ++head;
+
+        // The slot is released right away, so the handler may produce more completions without overflow.
+        __atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+
+        if (head == tail)
+            tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+    }
+}
+
+void linux_io_uring::recycle_buffer(std::uint16_t id) {
+    prepare_provide_buffers(id, 1);
+}
+
+bool linux_io_uring::prepare_provide_buffers(std::uint16_t first, std::uint16_t count) {
+    std::lock_guard<std::mutex> lock(m_sq_mutex);
+
+    auto sqe = get_sqe_locked();
+    if (!sqe)
+        return false;
+
+    sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+    sqe->fd = count;
+    sqe->addr = reinterpret_cast<std::uint64_t>(get_buffer(first));
+    sqe->len = std::uint32_t(m_buffer_size);
+    sqe->off = first;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+    sqe->user_data = make_user_data(0, op_type::PROVIDE);
+
+    push_sqe_locked();
+
+    return true;
+}
+
+io_uring_sqe *linux_io_uring::get_sqe_locked() {
+    unsigned tail = *m_sq_tail;
+    if (tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE) >= m_sq_entries) {
+        if (!submit_locked())
+            return nullptr;
+
+        if (tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE) >= m_sq_entries)
+            return nullptr;
+    }
+
+    auto sqe = &m_sqes[tail & m_sq_mask];
+    std::memset(sqe, 0, sizeof(*sqe));
+
+    return sqe;
+}
+
+void linux_io_uring::push_sqe_locked() {
+    __atomic_store_n(m_sq_tail, *m_sq_tail + 1, __ATOMIC_RELEASE);
+    ++m_sq_pending;
+}
+
+bool linux_io_uring::submit_locked() {
+    while (m_sq_pending) {
+        int res = io_uring_enter(m_fd, m_sq_pending, 0, 0, nullptr, 0);
+        if (res < 0) {
+            if (errno == EINTR)
+                continue;
+
+            // The completion queue is full: the entries are submitted later, once the completions are consumed.
+            if (errno == EAGAIN || errno == EBUSY)
+                break;
+
+            return false;
+        }
+
+        // Nothing was consumed, trying again right away would not help.
+        if (res == 0)
+            break;
+
+        m_sq_pending -= unsigned(res);
+    }
+
+    return true;
+}
+
+#else // IGNITE_HAVE_IO_URING
+
+bool linux_io_uring::has_buffer(std::uint32_t) {
+    return false;
+}
+
+std::uint16_t linux_io_uring::get_buffer_id(std::uint32_t) {
+    return 0;
+}
+
+bool linux_io_uring::has_more(std::uint32_t) {
+    return false;
+}
+
+bool linux_io_uring::is_supported() {
+    return false;
+}
+
+linux_io_uring::linux_io_uring(unsigned, std::uint16_t, std::size_t) {
+    throw ignite_error(error::code::INTERNAL, "io_uring is not supported");
+}
+
+linux_io_uring::~linux_io_uring() = default;
+
+void linux_io_uring::release() {
+}
+
+bool linux_io_uring::prepare_poll(int, std::uint64_t) {
+    return false;
+}
+
+bool linux_io_uring::prepare_recv(int, std::uint64_t) {
+    return false;
+}
+
+bool linux_io_uring::prepare_sendmsg(int, const msghdr *, std::uint64_t) {
+    return false;
+}
+
+bool linux_io_uring::submit() {
+    return false;
+}
+
+void linux_io_uring::wait(int) {
+}
+
+bool linux_io_uring::has_completions() const {
+    return false;
+}
+
+void linux_io_uring::for_each_completion(const std::function<void(std::uint64_t, std::int32_t, std::uint32_t)> &) {
+}
+
+void linux_io_uring::recycle_buffer(std::uint16_t) {
+}
+
+bool linux_io_uring::prepare_provide_buffers(std::uint16_t, std::uint16_t) {
+    return false;
+}
+
+#endif // IGNITE_HAVE_IO_URING
+
+} // namespace ignite::network::detail
@@ -0,0 +1,309 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <sys/socket.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace ignite::network::detail {
+
+/**
+ * Minimal io_uring wrapper working directly on top of the system calls.
+ *
+ * Receive operations get their buffers from the buffers provided to the kernel, so many connections share a fixed
+ * amount of memory. Submissions can be prepared from any thread, while completions are only handled by the thread
+ * which owns the ring.
+ */
+class linux_io_uring {
+public:
+    /**
+     * Operation type. Stored in the user data of the submission along with the connection ID.
+     */
+    enum class op_type : std::uint8_t {
+        /** Poll of a file descriptor. */
+        POLL = 1,
+
+        /** Multishot receive. */
+        RECV = 2,
+
+        /** Send. */
+        SEND = 3,
+
+        /** Buffer provision. Only completes on failure. */
+        PROVIDE = 4,
+    };
+
+    /**
+     * Make user data of the submission.
+     *
+     * @param id Connection ID.
+     * @param op Operation type.
+     * @return User data.
+     */
+    static std::uint64_t make_user_data(std::uint64_t id, op_type op) { return (id << 8) | std::uint64_t(op); }
+
+    /**
+     * Get connection ID from the user data.
+     *
+     * @param user_data User data.
+     * @return Connection ID.
+     */
+    static std::uint64_t get_id(std::uint64_t user_data) { return user_data >> 8; }
+
+    /**
+     * Get operation type from the user data.
+     *
+     * @param user_data User data.
+     * @return Operation type.
+     */
+    static op_type get_op(std::uint64_t user_data) { return op_type(user_data & 0xFF); }
+
+    /**
+     * Check whether the completion carries a provided buffer.
+     *
+     * @param flags Completion flags.
+     * @return @c true if the completion carries a buffer.
+     */
+    static bool has_buffer(std::uint32_t flags);
+
+    /**
+     * Get ID of the provided buffer carried by the completion.
+     *
+     * @param flags Completion flags.
+     * @return Buffer ID.
+     */
+    static std::uint16_t get_buffer_id(std::uint32_t flags);
+
+    /**
+     * Check whether more completions are going to be posted for the multishot operation.
+     *
+     * @param flags Completion flags.
+     * @return @c true if the operation is still active.
+     */
+    static bool has_more(std::uint32_t flags);
+
+    /**
+     * Check whether io_uring with all the used features is supported by the system. The check is performed once.
+     *
+     * @return @c true if supported.
+     */
+    static bool is_supported();
+
+    /**
+     * Constructor.
+     *
+     * @param entries Number of submission queue entries.
+     * @param buffer_count Number of provided receive buffers. Should be a power of two.
+     * @param buffer_size Size of a single provided receive buffer.
+     *
+     * @throw ignite_error on error.
+     */
+    linux_io_uring(unsigned entries, std::uint16_t buffer_count, std::size_t buffer_size);
+
+    /**
+     * Destructor.
+     */
+    ~linux_io_uring();
+
+    // Deleted
+    linux_io_uring(const linux_io_uring &) = delete;
+    linux_io_uring &operator=(const linux_io_uring &) = delete;
+
+    /**
+     * Prepare one-shot poll of the file descriptor for reading.
+     *
+     * @param fd File descriptor.
+     * @param user_data User data.
+     * @return @c true on success.
+     */
+    bool prepare_poll(int fd, std::uint64_t user_data);
+
+    /**
+     * Prepare multishot receive into the provided buffers.
+     *
+     * @param fd Socket file descriptor.
+     * @param user_data User data.
+     * @return @c true on success.
+     */
+    bool prepare_recv(int fd, std::uint64_t user_data);
+
+    /**
+     * Prepare send of the message. The message and the data it points to should stay valid until completion.
+     *
+     * @param fd Socket file descriptor.
+     * @param msg Message.
+     * @param user_data User data.
+     * @return @c true on success.
+     */
+    bool prepare_sendmsg(int fd, const msghdr *msg, std::uint64_t user_data);
+
+    /**
+     * Submit all the prepared operations with a single system call.
+     *
+     * @return @c true on success.
+     */
+    bool submit();
+
+    /**
+     * Submit all the prepared operations and wait for at least one completion.
+     *
+     * Should only be called by the owning thread.
+     *
+     * @param timeout Timeout in milliseconds. Negative value means no timeout.
+     */
+    void wait(int timeout);
+
+    /**
+     * Check whether there are completions to handle.
+     *
+     * Should only be called by the owning thread.
+     *
+     * @return @c true if there are completions to handle.
+     */
+    [[nodiscard]] bool has_completions() const;
+
+    /**
+     * Handle all the available completions.
+     *
+     * Should only be called by the owning thread.
+     *
+     * @param handler Completion handler. Called with user data, result and flags of the completion.
+     */
+    void for_each_completion(const std::function<void(std::uint64_t, std::int32_t, std::uint32_t)> &handler);
+
+    /**
+     * Get provided buffer.
+     *
+     * @param id Buffer ID.
+     * @return Buffer.
+     */
+    [[nodiscard]] std::byte *get_buffer(std::uint16_t id) { return m_buffers.data() + id * m_buffer_size; }
+
+    /**
+     * Return provided buffer to the kernel once the received data is handled. The buffer is handed over with the
+     * next submission.
+     *
+     * @param id Buffer ID.
+     */
+    void recycle_buffer(std::uint16_t id);
+
+private:
+    /**
+     * Unmap the memory and close the ring.
+     */
+    void release();
+
+    /**
+     * Get the next free submission queue entry, submitting prepared operations if the queue is full.
+     *
+     * @warning Can only be called when holding m_sq_mutex lock.
+     * @return Entry or null if there is no free entry.
+     */
+    io_uring_sqe *get_sqe_locked();
+
+    /**
+     * Prepare provision of the consecutive buffers to the kernel.
+     *
+     * @param first First buffer ID.
+     * @param count Number of buffers.
+     * @return @c true on success.
+     */
+    bool prepare_provide_buffers(std::uint16_t first, std::uint16_t count);
+
+    /**
+     * Publish the entry obtained with get_sqe_locked().
+     *
+     * @warning Can only be called when holding m_sq_mutex lock.
+     */
+    void push_sqe_locked();
+
+    /**
+     * Submit prepared operations.
+     *
+     * @warning Can only be called when holding m_sq_mutex lock.
+     * @return @c true on success.
+     */
+    bool submit_locked();
+
+    /** Ring file descriptor. */
+    int m_fd{-1};
+
+    /** Submission queue ring memory. */
+    void *m_sq_ring{nullptr};
+
+    /** Submission queue ring memory size. */
+    std::size_t m_sq_ring_size{0};
+
+    /** Completion queue ring memory. Same as the submission queue ring memory if mapped once. */
+    void *m_cq_ring{nullptr};
+
+    /** Completion queue ring memory size. */
+    std::size_t m_cq_ring_size{0};
+
+    /** Submission queue entries. */
+    io_uring_sqe *m_sqes{nullptr};
+
+    /** Number of submission queue entries. */
+    unsigned m_sq_entries{0};
+
+    /** Submission queue head. Advanced by the kernel. */
+    unsigned *m_sq_head{nullptr};
+
+    /** Submission queue tail. */
+    unsigned *m_sq_tail{nullptr};
+
+    /** Submission queue mask. */
+    unsigned m_sq_mask{0};
+
+    /** Number of prepared and not submitted operations. Protected by m_sq_mutex. */
+    unsigned m_sq_pending{0};
+
+    /** Submission queue mutex. */
+    std::mutex m_sq_mutex;
+
+    /** Completion queue head. */
+    unsigned *m_cq_head{nullptr};
+
+    /** Completion queue tail. Advanced by the kernel. */
+    unsigned *m_cq_tail{nullptr};
+
+    /** Completion queue mask. */
+    unsigned m_cq_mask{0};
+
+    /** Completion queue entries. */
+    io_uring_cqe *m_cqes{nullptr};
+
+    /** Number of provided buffers. */
+    std::uint16_t m_buffer_count{0};
+
+    /** Size of a single provided buffer. */
+    std::size_t m_buffer_size{0};
+
+    /** Provided buffers memory. */
+    std::vector<std::byte> m_buffers;
+};
+
+} // namespace ignite::network::detail
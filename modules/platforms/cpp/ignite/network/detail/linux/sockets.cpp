@@ -120,6 +120,28 @@ void try_set_socket_options(int socket_fd, int buf_size, bool no_delay, bool out
         socket_fd, IPPROTO_TCP, TCP_KEEPINTVL, reinterpret_cast<char *>(&idle_retry_opt), sizeof(idle_retry_opt));
 }
 
+void try_set_low_latency_options(int socket_fd, std::chrono::microseconds busy_poll) {
+#ifdef SO_BUSY_POLL
+    if (busy_poll.count() > 0) {
+        int busy_poll_us = int(busy_poll.count());
+        setsockopt(socket_fd, SOL_SOCKET, SO_BUSY_POLL, reinterpret_cast<char *>(&busy_poll_us), sizeof(busy_poll_us));
+    }
+#else
+    (void) busy_poll;
+#endif
+
+    try_set_quick_ack(socket_fd);
+}
+
+void try_set_quick_ack(int socket_fd) {
+#ifdef TCP_QUICKACK
+    int quick_ack = 1;
+    setsockopt(socket_fd, IPPROTO_TCP, TCP_QUICKACK, reinterpret_cast<char *>(&quick_ack), sizeof(quick_ack));
+#else
+    (void) socket_fd;
+#endif
+}
+
 int wait_on_socket(int socket, std::int32_t timeout, bool rd) {
     int32_t timeout0 = timeout == 0 ? -1 : timeout;
 
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <string>
 
@@ -50,6 +51,22 @@ std::string get_last_socket_error_message();
  */
 void try_set_socket_options(int socket_fd, int buf_size, bool no_delay, bool out_of_band, bool keep_alive);
 
+/**
+ * Try and set low latency socket options: SO_BUSY_POLL and TCP_QUICKACK. Options which are not supported by the
+ * system are skipped.
+ *
+ * @param socket_fd Socket file descriptor.
+ * @param busy_poll Time the kernel polls the device queue for data on reads. Zero means it is not set.
+ */
+void try_set_low_latency_options(int socket_fd, std::chrono::microseconds busy_poll);
+
+/**
+ * Try and enable TCP_QUICKACK. The system disables it again at will, so it is re-enabled after reads.
+ *
+ * @param socket_fd Socket file descriptor.
+ */
+void try_set_quick_ack(int socket_fd);
+
 /**
  * Wait on the socket for any event for specified time.
  * This function uses poll to achieve timeout functionality for every separate socket operation.
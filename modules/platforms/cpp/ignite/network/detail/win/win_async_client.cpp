@@ -20,6 +20,8 @@
 
 #include "../utils.h"
 
+#include <ignite/common/detail/buffer_pool.h>
+
 #include <algorithm>
 #include <cassert>
 
@@ -156,8 +158,10 @@ bool win_async_client::process_sent(size_t bytes) {
 
     front.skip(static_cast<int32_t>(bytes));
 
-    if (front.empty())
+    if (front.empty()) {
+        ignite::detail::buffer_pool::get_default().release(std::move(front).extract_data());
         m_send_packets.pop_front();
+    }
 
     return send_next_packet_locked();
 }
@@ -70,6 +70,14 @@ void win_async_client_pool::stop() {
     internal_stop();
 }
 
+void win_async_client_pool::add_addresses(std::vector<tcp_range> addrs) {
+    m_connecting_thread.add_addresses(std::move(addrs));
+}
+
+void win_async_client_pool::remove_addresses(std::vector<tcp_range> addrs) {
+    m_connecting_thread.remove_addresses(addrs);
+}
+
 void win_async_client_pool::internal_stop() {
     if (m_stopping)
         return;
@@ -151,6 +159,12 @@ void win_async_client_pool::handle_message_sent(uint64_t id) {
         asyncHandler0->on_message_sent(id);
 }
 
+void win_async_client_pool::handle_timer_tick() {
+    auto asyncHandler0 = m_async_handler.lock();
+    if (asyncHandler0)
+        asyncHandler0->on_timer_tick();
+}
+
 bool win_async_client_pool::send(uint64_t id, std::vector<std::byte> &&data) {
     if (m_stopping)
         throw ignite_error("Client is stopped");
@@ -65,6 +65,20 @@ public:
      */
     void stop() override;
 
+    /**
+     * Add addresses to connect to. Addresses which are already known are ignored.
+     *
+     * @param addrs Addresses.
+     */
+    void add_addresses(std::vector<tcp_range> addrs) override;
+
+    /**
+     * Remove addresses. The established connections are kept, but are not re-established once closed.
+     *
+     * @param addrs Addresses.
+     */
+    void remove_addresses(std::vector<tcp_range> addrs) override;
+
     /**
      * Set handler.
      *
@@ -148,6 +162,11 @@ public:
      */
     void handle_message_sent(uint64_t id);
 
+    /**
+     * Handle timer tick event.
+     */
+    void handle_timer_tick();
+
 private:
     /**
      * Close all established connections and stops handling threads.
@@ -21,6 +21,7 @@
 #include "sockets.h"
 #include "win_async_client_pool.h"
 
+#include <algorithm>
 #include <cassert>
 #include <random>
 
@@ -43,6 +44,8 @@ win_async_connecting_thread::win_async_connecting_thread()
     , m_stopping(false)
     , m_failed_attempts(0)
     , m_min_addrs(0)
+    , m_limit(0)
+    , m_known_addrs()
     , m_addrs_mutex()
     , m_connect_needed()
     , m_non_connected()
@@ -107,15 +110,63 @@ void win_async_connecting_thread::run() {
 void win_async_connecting_thread::notify_free_address(const tcp_range &range) {
     std::lock_guard<std::mutex> lock(m_addrs_mutex);
 
+    if (std::find(m_known_addrs.begin(), m_known_addrs.end(), range) == m_known_addrs.end())
+        return;
+
     m_non_connected.push_back(range);
     m_connect_needed.notify_one();
 }
 
+void win_async_connecting_thread::add_addresses(std::vector<tcp_range> addrs) {
+    std::lock_guard<std::mutex> lock(m_addrs_mutex);
+
+    // Only addresses known before are skipped, as an address may be listed several times.
+    auto known_end = m_known_addrs.size();
+
+    bool added = false;
+    for (auto &addr : addrs) {
+        auto known_last = m_known_addrs.begin() + std::ptrdiff_t(known_end);
+        if (std::find(m_known_addrs.begin(), known_last, addr) != known_last)
+            continue;
+
+        m_known_addrs.push_back(addr);
+        m_non_connected.push_back(std::move(addr));
+        added = true;
+    }
+
+    if (!added)
+        return;
+
+    if (!m_limit || m_limit > m_known_addrs.size())
+        m_min_addrs = 0;
+    else
+        m_min_addrs = m_known_addrs.size() - m_limit;
+
+    m_connect_needed.notify_one();
+}
+
+void win_async_connecting_thread::remove_addresses(const std::vector<tcp_range> &addrs) {
+    std::lock_guard<std::mutex> lock(m_addrs_mutex);
+
+    for (const auto &addr : addrs) {
+        m_known_addrs.erase(std::remove(m_known_addrs.begin(), m_known_addrs.end(), addr), m_known_addrs.end());
+        m_non_connected.erase(
+            std::remove(m_non_connected.begin(), m_non_connected.end(), addr), m_non_connected.end());
+    }
+
+    if (!m_limit || m_limit > m_known_addrs.size())
+        m_min_addrs = 0;
+    else
+        m_min_addrs = m_known_addrs.size() - m_limit;
+}
+
 void win_async_connecting_thread::start(win_async_client_pool &clientPool, size_t limit, std::vector<tcp_range> addrs) {
     m_stopping = false;
     m_client_pool = &clientPool;
     m_failed_attempts = 0;
     m_non_connected = std::move(addrs);
+    m_known_addrs = m_non_connected;
+    m_limit = limit;
 
     if (!limit || limit > m_non_connected.size())
         m_min_addrs = 0;
@@ -138,6 +189,7 @@ void win_async_connecting_thread::stop() {
 
     m_thread.join();
     m_non_connected.clear();
+    m_known_addrs.clear();
 }
 
 std::shared_ptr<win_async_client> win_async_connecting_thread::try_connect(const tcp_range &range) {
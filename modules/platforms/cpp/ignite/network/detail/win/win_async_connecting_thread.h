@@ -61,12 +61,26 @@ public:
     void stop();
 
     /**
-     * Notify about new address available for connection.
+     * Notify about new address available for connection. Addresses which were removed are ignored.
      *
      * @param range Address range.
      */
     void notify_free_address(const tcp_range &range);
 
+    /**
+     * Add addresses to connect to.
+     *
+     * @param addrs Addresses.
+     */
+    void add_addresses(std::vector<tcp_range> addrs);
+
+    /**
+     * Remove addresses. Connections to them are not established anymore.
+     *
+     * @param addrs Addresses.
+     */
+    void remove_addresses(const std::vector<tcp_range> &addrs);
+
 private:
     /**
      * Run thread.
@@ -110,6 +124,12 @@ private:
     /** Minimal number of addresses. */
     size_t m_min_addrs;
 
+    /** Connection limit. Zero means limit is disabled. */
+    size_t m_limit;
+
+    /** Known addresses, both connected and not. */
+    std::vector<tcp_range> m_known_addrs;
+
     /** Addresses critical section. */
     mutable std::mutex m_addrs_mutex;
 
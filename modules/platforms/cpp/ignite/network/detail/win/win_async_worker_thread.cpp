@@ -35,13 +35,15 @@ win_async_worker_thread::win_async_worker_thread()
     : m_thread()
     , m_stopping(false)
     , m_client_pool(nullptr)
-    , m_iocp(NULL) {
+    , m_iocp(NULL)
+    , m_next_timer_tick() {
 }
 
 void win_async_worker_thread::start(win_async_client_pool &clientPool0, HANDLE iocp0) {
     assert(iocp0 != NULL);
     m_iocp = iocp0;
     m_client_pool = &clientPool0;
+    m_next_timer_tick = std::chrono::steady_clock::now() + async_handler::TIMER_TICK_INTERVAL;
 
     m_thread = std::thread(&win_async_worker_thread::run, this);
 }
@@ -54,11 +56,14 @@ void win_async_worker_thread::run() {
         ULONG_PTR key = NULL;
         LPOVERLAPPED overlapped = NULL;
 
-        BOOL ok = GetQueuedCompletionStatus(m_iocp, &bytesTransferred, &key, &overlapped, INFINITE);
+        BOOL ok = GetQueuedCompletionStatus(
+            m_iocp, &bytesTransferred, &key, &overlapped, calculate_timer_tick_timeout());
 
         if (m_stopping)
             break;
 
+        handle_timer_tick();
+
         if (!key)
             continue;
 
@@ -129,4 +134,22 @@ void win_async_worker_thread::stop() {
     m_thread.join();
 }
 
+void win_async_worker_thread::handle_timer_tick() {
+    auto now = std::chrono::steady_clock::now();
+    if (now < m_next_timer_tick)
+        return;
+
+    m_next_timer_tick = now + async_handler::TIMER_TICK_INTERVAL;
+
+    m_client_pool->handle_timer_tick();
+}
+
+DWORD win_async_worker_thread::calculate_timer_tick_timeout() const {
+    auto left = m_next_timer_tick - std::chrono::steady_clock::now();
+    if (left <= std::chrono::steady_clock::duration::zero())
+        return 0;
+
+    return DWORD(std::chrono::ceil<std::chrono::milliseconds>(left).count());
+}
+
 } // namespace ignite::network::detail
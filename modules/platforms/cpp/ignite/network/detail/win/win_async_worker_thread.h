@@ -21,6 +21,7 @@
 
 #include "ignite/common/ignite_error.h"
 
+#include <chrono>
 #include <cstdint>
 #include <thread>
 
@@ -58,6 +59,18 @@ private:
      */
     void run();
 
+    /**
+     * Notify the pool about a timer tick if the tick interval has passed.
+     */
+    void handle_timer_tick();
+
+    /**
+     * Calculate time left until the next timer tick.
+     *
+     * @return Timeout in milliseconds.
+     */
+    [[nodiscard]] DWORD calculate_timer_tick_timeout() const;
+
     /** Thread. */
     std::thread m_thread;
 
@@ -69,6 +82,9 @@ private:
 
     /** IO Completion Port. Windows-specific primitive for asynchronous IO. */
     HANDLE m_iocp;
+
+    /** Time of the next timer tick. */
+    std::chrono::steady_clock::time_point m_next_timer_tick;
 };
 
 } // namespace ignite::network::detail
@@ -47,6 +47,14 @@ void error_handling_filter::on_message_sent(uint64_t id) {
     close_connection_on_exception(id, [this, id] { data_filter_adapter::on_message_sent(id); });
 }
 
+void error_handling_filter::on_timer_tick() {
+    try {
+        data_filter_adapter::on_timer_tick();
+    } catch (...) {
+        // No-op.
+    }
+}
+
 void error_handling_filter::close_connection_on_exception(uint64_t id, const std::function<void()> &func) {
     try {
         func();
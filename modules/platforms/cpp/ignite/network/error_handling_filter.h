@@ -67,6 +67,11 @@ public:
      */
     void on_message_sent(uint64_t id) override;
 
+    /**
+     * Callback that called periodically by the IO thread.
+     */
+    void on_timer_tick() override;
+
 private:
     /**
      * Execute function and handle all possible exceptions.
@@ -20,6 +20,8 @@
 #include "ignite/common/detail/bytes.h"
 #include <ignite/protocol/utils.h>
 
+#include <string>
+
 namespace ignite::network {
 
 length_prefix_codec::length_prefix_codec()
@@ -56,6 +58,22 @@ data_buffer_ref length_prefix_codec::decode(data_buffer_ref &data) {
     if (m_packet.empty() || m_packet.size() == (PACKET_HEADER_SIZE + m_packet_size))
         reset_buffer();
 
+    if (m_packet.empty()) {
+        // The whole packet is received in one piece, so it is returned as is, without copying.
+        auto received = data.get_bytes_view();
+        if (received.size() >= PACKET_HEADER_SIZE) {
+            auto packet_size = detail::bytes::load<detail::endian::BIG, int32_t>(received.data());
+            if (packet_size < 0)
+                throw ignite_error("Invalid packet size: " + std::to_string(packet_size));
+
+            if (received.size() - PACKET_HEADER_SIZE >= size_t(packet_size)) {
+                data.skip(PACKET_HEADER_SIZE + packet_size);
+
+                return {received, PACKET_HEADER_SIZE, size_t(packet_size)};
+            }
+        }
+    }
+
     if (m_packet_size < 0) {
         consume(data, PACKET_HEADER_SIZE);
 
@@ -63,6 +81,11 @@ data_buffer_ref length_prefix_codec::decode(data_buffer_ref &data) {
             return {};
 
         m_packet_size = detail::bytes::load<detail::endian::BIG, int32_t>(m_packet.data());
+        if (m_packet_size < 0)
+            throw ignite_error("Invalid packet size: " + std::to_string(m_packet_size));
+
+        // The packet spans several reads, so the buffer is allocated once for the whole packet.
+        m_packet.reserve(PACKET_HEADER_SIZE + m_packet_size);
     }
 
     consume(data, m_packet_size + PACKET_HEADER_SIZE);
@@ -51,8 +51,11 @@ public:
     /**
      * Decode provided data.
      *
+     * When the whole packet is present in the provided data, the result refers to the provided data directly.
+     * Otherwise, the data is accumulated in the internal buffer until the packet is complete.
+     *
      * @param data Data to decode.
-     * @return Decoded data. Returning null means data is not yet ready.
+     * @return Decoded data. Returning null means data is not yet ready. Valid until the next call.
      *
      * @throw ignite_error on error.
      */
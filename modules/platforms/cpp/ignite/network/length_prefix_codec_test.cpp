@@ -0,0 +1,150 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/network/length_prefix_codec.h"
+
+#include <ignite/protocol/utils.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::network;
+
+namespace {
+
+/**
+ * Append a packet with the specified payload to the buffer.
+ *
+ * @param buf Buffer.
+ * @param payload Payload.
+ */
+void append_packet(std::vector<std::byte> &buf, const std::vector<std::byte> &payload) {
+    auto size = std::uint32_t(payload.size());
+    for (int shift = 24; shift >= 0; shift -= 8)
+        buf.push_back(std::byte((size >> shift) & 0xFF));
+
+    buf.insert(buf.end(), payload.begin(), payload.end());
+}
+
+/**
+ * Make payload of the specified size.
+ *
+ * @param size Size.
+ * @return Payload.
+ */
+std::vector<std::byte> make_payload(std::size_t size) {
+    std::vector<std::byte> payload(size);
+    for (std::size_t i = 0; i < size; ++i)
+        payload[i] = std::byte(i % 251);
+
+    return payload;
+}
+
+/**
+ * Make a codec which has already received magic bytes.
+ *
+ * @return Codec.
+ */
+length_prefix_codec make_codec() {
+    length_prefix_codec codec;
+
+    std::vector<std::byte> magic(protocol::MAGIC_BYTES.begin(), protocol::MAGIC_BYTES.end());
+    data_buffer_ref data{bytes_view{magic}};
+    EXPECT_TRUE(codec.decode(data).empty());
+    EXPECT_TRUE(data.empty());
+
+    return codec;
+}
+
+} // namespace
+
+TEST(length_prefix_codec, whole_packet_is_not_copied) {
+    auto codec = make_codec();
+    auto payload = make_payload(100);
+
+    std::vector<std::byte> buf;
+    append_packet(buf, payload);
+
+    data_buffer_ref data{bytes_view{buf}};
+    auto out = codec.decode(data);
+
+    EXPECT_TRUE(data.empty());
+    EXPECT_EQ(buf.data() + length_prefix_codec::PACKET_HEADER_SIZE, out.get_bytes_view().data());
+    EXPECT_EQ(bytes_view{payload}, out.get_bytes_view());
+}
+
+TEST(length_prefix_codec, several_packets_in_one_read) {
+    auto codec = make_codec();
+    auto payload1 = make_payload(10);
+    auto payload2 = make_payload(20);
+
+    std::vector<std::byte> buf;
+    append_packet(buf, payload1);
+    append_packet(buf, payload2);
+
+    data_buffer_ref data{bytes_view{buf}};
+
+    EXPECT_EQ(bytes_view{payload1}, codec.decode(data).get_bytes_view());
+    EXPECT_EQ(bytes_view{payload2}, codec.decode(data).get_bytes_view());
+    EXPECT_TRUE(data.empty());
+    EXPECT_TRUE(codec.decode(data).empty());
+}
+
+TEST(length_prefix_codec, packet_spanning_reads) {
+    auto codec = make_codec();
+    auto payload = make_payload(1000);
+    auto next_payload = make_payload(5);
+
+    std::vector<std::byte> buf;
+    append_packet(buf, payload);
+    append_packet(buf, next_payload);
+
+    // Split inside the header of the first packet and inside the header of the second one.
+    std::vector<std::size_t> splits{2, 500, buf.size() - next_payload.size() - 2, buf.size()};
+
+    std::vector<std::vector<std::byte>> decoded;
+    std::size_t pos = 0;
+    for (auto split : splits) {
+        data_buffer_ref data{bytes_view{buf.data() + pos, split - pos}};
+        pos = split;
+
+        while (true) {
+            auto out = codec.decode(data);
+            if (out.empty())
+                break;
+
+            decoded.emplace_back(out.get_bytes_view().begin(), out.get_bytes_view().end());
+        }
+        EXPECT_TRUE(data.empty());
+    }
+
+    ASSERT_EQ(2, decoded.size());
+    EXPECT_EQ(payload, decoded[0]);
+    EXPECT_EQ(next_payload, decoded[1]);
+}
+
+TEST(length_prefix_codec, unknown_magic_bytes) {
+    length_prefix_codec codec;
+
+    std::vector<std::byte> magic(protocol::MAGIC_BYTES.size(), std::byte{0});
+    data_buffer_ref data{bytes_view{magic}};
+
+    EXPECT_THROW((void) codec.decode(data), ignite_error);
+}
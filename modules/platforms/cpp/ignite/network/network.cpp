@@ -38,9 +38,13 @@ std::unique_ptr<socket_client> make_tcp_socket_client() {
     return std::make_unique<tcp_socket_client>();
 }
 
-std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters) {
-    auto pool =
-        std::make_shared<IGNITE_SWITCH_WIN_OTHER(detail::win_async_client_pool, detail::linux_async_client_pool)>();
+std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters, std::uint32_t io_threads) {
+#ifdef _WIN32
+    (void) io_threads;
+    auto pool = std::make_shared<detail::win_async_client_pool>();
+#else
+    auto pool = std::make_shared<detail::linux_async_client_pool>(io_threads);
+#endif
 
     return std::make_shared<async_client_pool_adapter>(std::move(filters), std::move(pool));
 }
@@ -22,6 +22,7 @@
 #include <ignite/network/socket_client.h>
 #include <ignite/network/ssl/secure_configuration.h>
 
+#include <cstdint>
 #include <string>
 
 namespace ignite::network {
@@ -35,9 +36,10 @@ std::unique_ptr<socket_client> make_tcp_socket_client();
  * Make asynchronous client pool.
  *
  * @param filters Filters.
+ * @param io_threads Number of IO threads. Ignored on Windows, where a single IO completion port is used.
  * @return Async client pool.
  */
-std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters);
+std::shared_ptr<async_client_pool> make_async_client_pool(data_filters filters, std::uint32_t io_threads);
 
 /**
  * Ensure that SSL library is loaded.
@@ -21,7 +21,9 @@
 #include <ignite/odbc/query/result_page.h>
 
 #include <memory>
+#include <optional>
 
+#include <cassert>
 #include <cstdint>
 
 namespace ignite {
@@ -48,6 +50,8 @@ public:
      * @return False if data update required or no more data.
      */
     bool next(const column_meta_vector &columns) {
+        m_row.reset();
+
         if (!has_data())
             return false;
 
@@ -58,16 +62,7 @@ public:
         }
 
         ++m_result_set_pos;
-        auto row_data = m_current_page->get_row(m_page_pos);
-
-        auto columns_cnt = columns.size();
-        binary_tuple_parser parser(std::int32_t(columns_cnt), row_data);
-
-        m_row.clear();
-        for (size_t i = 0; i < columns_cnt; ++i) {
-            auto &column = columns[i];
-            m_row.push_back(protocol::read_next_column(parser, column.get_data_type(), column.get_scale()));
-        }
+        m_row.emplace(std::int32_t(columns.size()), m_current_page->get_row(m_page_pos));
 
         return true;
     }
@@ -89,15 +84,39 @@ public:
 
         m_page_pos = -1;
 
-        m_row.clear();
+        m_row.reset();
     }
 
     /**
-     * Get the current row.
+     * Check if the cursor is positioned on a row.
+     *
+     * @return True if the cursor is positioned on a row.
+     */
+    [[nodiscard]] bool has_row() const { return m_row.has_value(); }
+
+    /**
+     * Get the number of columns in the current row.
      *
-     * @return  Row.
+     * @return Number of columns.
      */
-    [[nodiscard]] const std::vector<primitive> &get_row() const { return m_row; }
+    [[nodiscard]] std::size_t get_row_size() const { return m_row ? std::size_t(m_row->num_elements()) : 0; }
+
+    /**
+     * Read a value of the current row.
+     *
+     * Only the requested column is decoded, so the columns that are not fetched
+     * by the application cost nothing.
+     *
+     * @param idx Zero-based column index.
+     * @param column Column metadata.
+     * @return Column value.
+     */
+    [[nodiscard]] primitive get_value(std::size_t idx, const column_meta &column) const {
+        assert(m_row && idx < get_row_size());
+
+        return protocol::read_column(
+            m_row->get_element(std::int32_t(idx)), column.get_data_type(), column.get_scale());
+    }
 
     /**
      * Get the current position in the result set.
@@ -117,7 +136,7 @@ private:
     std::int32_t m_result_set_pos{0};
 
     /** Current row. */
-    std::vector<primitive> m_row;
+    std::optional<binary_tuple_parser> m_row;
 };
 
 } // namespace ignite
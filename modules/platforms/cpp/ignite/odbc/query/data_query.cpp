@@ -189,17 +189,17 @@ sql_result data_query::fetch_next_row(column_binding_map &column_bindings) {
         return res;
     }
 
-    auto row = m_cursor->get_row();
-    assert(!row.empty());
+    assert(m_cursor->has_row());
 
-    for (std::size_t i = 0; i < row.size(); ++i) {
+    // Only the bound columns are decoded.
+    auto row_size = m_cursor->get_row_size();
+    for (auto &[column_idx, buffer] : column_bindings) {
         // Column indexing starts from 1 in ODBC.
-        auto column_idx = std::int32_t(i + 1);
-        auto it = column_bindings.find(column_idx);
-        if (it == column_bindings.end())
+        auto i = std::size_t(column_idx - 1);
+        if (column_idx < 1 || i >= row_size)
             continue;
 
-        auto conv_res = put_primitive_to_buffer(it->second, row[i]);
+        auto conv_res = put_primitive_to_buffer(buffer, m_cursor->get_value(i, m_result_meta[i]));
         auto result = process_conversion_result(conv_res, m_cursor->get_result_set_pos(), column_idx);
 
         if (result == sql_result::AI_ERROR)
@@ -219,8 +219,7 @@ sql_result data_query::get_column(std::uint16_t column_idx, application_data_buf
     if (!m_has_rowset || !has_more_rows() || !m_cursor)
         return sql_result::AI_NO_DATA;
 
-    auto row = m_cursor->get_row();
-    if (row.empty()) {
+    if (!m_cursor->has_row()) {
         m_diag.add_status_record(sql_state::S24000_INVALID_CURSOR_STATE,
             "Cursor is in a wrong position. "
             "It is either have reached the end of the result set or no data was yet fetched.");
@@ -228,7 +227,8 @@ sql_result data_query::get_column(std::uint16_t column_idx, application_data_buf
         return sql_result::AI_ERROR;
     }
 
-    auto conv_res = put_primitive_to_buffer(buffer, row[column_idx - 1]);
+    auto i = std::size_t(column_idx - 1);
+    auto conv_res = put_primitive_to_buffer(buffer, m_cursor->get_value(i, m_result_meta[i]));
     sql_result result = process_conversion_result(conv_res, m_cursor->get_result_set_pos(), column_idx);
 
     return result;
@@ -85,11 +85,21 @@ public:
     sql_result fetch_next_row();
 
     /**
-     * Get current row.
+     * Get the number of columns in the current row.
      *
-     * @return  Row.
+     * @return Number of columns. Zero if no row is fetched.
      */
-    [[nodiscard]] const std::vector<primitive> &get_current_row() const { return m_cursor->get_row(); }
+    [[nodiscard]] std::size_t get_current_row_size() const { return m_cursor ? m_cursor->get_row_size() : 0; }
+
+    /**
+     * Get a value of the current row. Only the requested column is decoded.
+     *
+     * @param idx Zero-based column index. Must be less than the current row size.
+     * @return Column value.
+     */
+    [[nodiscard]] primitive get_current_value(std::size_t idx) const {
+        return m_cursor->get_value(idx, m_result_meta[idx]);
+    }
 
     /**
      * Fetch next result row to application buffers.
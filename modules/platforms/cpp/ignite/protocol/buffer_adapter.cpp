@@ -21,15 +21,21 @@
 #include <ignite/common/ignite_error.h>
 #include <ignite/protocol/utils.h>
 
+#include <limits>
+#include <string>
+
 namespace ignite::protocol {
 
 void buffer_adapter::write_length_header() {
     if (m_length_pos == std::numeric_limits<std::size_t>::max() || m_length_pos + LENGTH_HEADER_SIZE > m_buffer.size())
         throw ignite_error("Length header was not reserved properly in buffer");
 
-    auto length = std::int32_t(m_buffer.size() - (m_length_pos + LENGTH_HEADER_SIZE));
+    // We do not support messages larger than MAX_INT32.
+    auto length = m_buffer.size() - (m_length_pos + LENGTH_HEADER_SIZE);
+    if (length > std::size_t(std::numeric_limits<std::int32_t>::max()))
+        throw ignite_error("Message is too large: " + std::to_string(length) + " bytes");
 
-    detail::bytes::store<detail::endian::BIG, int32_t>(m_buffer.data() + m_length_pos, length);
+    detail::bytes::store<detail::endian::BIG, int32_t>(m_buffer.data() + m_length_pos, std::int32_t(length));
 }
 
 } // namespace ignite::protocol
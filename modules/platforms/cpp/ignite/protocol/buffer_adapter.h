@@ -19,7 +19,9 @@
 
 #include <ignite/common/bytes_view.h>
 
+#include <cstddef>
 #include <limits>
+#include <vector>
 
 namespace ignite::protocol {
 
@@ -49,6 +51,26 @@ public:
      */
     void write_raw(bytes_view data) { m_buffer.insert(m_buffer.end(), data.begin(), data.end()); }
 
+    /**
+     * Extend the buffer by the specified number of bytes, so they can be written in place.
+     *
+     * @param size Number of bytes.
+     * @return Pointer to the added bytes. Valid until the buffer is extended again.
+     */
+    [[nodiscard]] std::byte *extend(std::size_t size) {
+        auto pos = m_buffer.size();
+        m_buffer.resize(pos + size);
+
+        return m_buffer.data() + pos;
+    }
+
+    /**
+     * Get underlying data buffer to write data in place.
+     *
+     * @return Underlying data buffer.
+     */
+    [[nodiscard]] std::vector<std::byte> &get_buffer() { return m_buffer; }
+
     /**
      * Get underlying data buffer view.
      *
@@ -23,6 +23,9 @@ namespace ignite::protocol {
  * Client operation code.
  */
 enum class client_operation {
+    /** Heartbeat. */
+    HEARTBEAT = 1,
+
     /** Get all tables. */
     TABLES_GET = 3,
 
@@ -116,6 +119,9 @@ enum class client_operation {
     /** Close cursor. */
     SQL_CURSOR_CLOSE = 52,
 
+    /** Get partition assignment. */
+    PARTITION_ASSIGNMENT_GET = 53,
+
     /** Execute SQL script. */
     SQL_EXEC_SCRIPT = 56,
 
@@ -131,6 +137,9 @@ enum class client_operation {
     /** Change compute job priority. */
     COMPUTE_CHANGE_PRIORITY = 61,
 
+    /** Send streamer batch. */
+    STREAMER_BATCH_SEND = 62,
+
     /** Execute SQL query with the parameters batch. */
     SQL_EXEC_BATCH = 63,
 };
@@ -62,9 +62,12 @@ handshake_response parse_handshake_response(bytes_view message) {
     if (res.error)
         return res;
 
-    UNUSED_VALUE reader.read_int64(); // TODO: IGNITE-17606 Implement heartbeats
+    res.idle_timeout = std::chrono::milliseconds(reader.read_int64());
     UNUSED_VALUE reader.skip(); // Cluster node ID. Needed for partition-aware compute.
-    UNUSED_VALUE reader.read_string_nullable(); // Cluster node name. Needed for partition-aware compute.
+
+    auto node_name = reader.read_string_nullable();
+    if (node_name)
+        res.context.set_node_name(std::move(*node_name));
 
     auto cluster_ids_len = reader.read_int32();
     if (cluster_ids_len <= 0) {
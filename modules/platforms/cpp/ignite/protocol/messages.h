@@ -23,6 +23,7 @@
 #include "ignite/common/bytes_view.h"
 #include "ignite/common/ignite_error.h"
 
+#include <chrono>
 #include <map>
 #include <vector>
 
@@ -65,6 +66,9 @@ struct handshake_response {
 
     /** Observable timestamp. */
     int64_t observable_timestamp;
+
+    /** Server idle timeout. Zero means the server does not close idle connections. */
+    std::chrono::milliseconds idle_timeout{0};
 };
 
 /**
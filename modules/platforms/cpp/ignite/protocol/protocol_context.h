@@ -22,6 +22,7 @@
 #include "ignite/common/detail/server_version.h"
 #include "ignite/common/uuid.h"
 
+#include <string>
 #include <vector>
 
 namespace ignite::protocol {
@@ -89,6 +90,20 @@ public:
      */
     void set_cluster_name(std::string name) { m_cluster_name = std::move(name); }
 
+    /**
+     * Get the name of the node the connection is established to.
+     *
+     * @return Node name.
+     */
+    [[nodiscard]] const std::string &get_node_name() const { return m_node_name; }
+
+    /**
+     * Set the name of the node the connection is established to.
+     *
+     * @param name Name to set.
+     */
+    void set_node_name(std::string name) { m_node_name = std::move(name); }
+
 private:
     /** Protocol version. */
     protocol_version m_version{protocol_version::get_current()};
@@ -101,6 +116,9 @@ private:
 
     /** Cluster name. */
     std::string m_cluster_name{};
+
+    /** Node name. */
+    std::string m_node_name{};
 };
 
 } // namespace ignite::protocol
@@ -15,36 +15,329 @@
  * limitations under the License.
  */
 
+
 #include "ignite/protocol/reader.h"
 
-#include <ignite/protocol/utils.h>
+#include <ignite/common/detail/bytes.h>
+#include <ignite/protocol/extension_types.h>
 
 namespace ignite::protocol {
 
-reader::reader(bytes_view buffer)
-    : m_buffer(buffer)
-    , m_current_val()
-    , m_move_res(MSGPACK_UNPACK_SUCCESS) {
+namespace {
+
+/**
+ * Load big-endian value.
+ *
+ * @tparam T Value type.
+ * @param data Data.
+ * @param pos Position of the value.
+ * @return Value.
+ */
+template<typename T>
+T load(bytes_view data, std::size_t pos) {
+    return detail::bytes::load<detail::endian::BIG, T>(data.data() + pos);
+}
+
+} // namespace
 
-    msgpack_unpacked_init(&m_current_val);
+bool reader::peek_integer(std::int64_t &value, std::size_t &size) const {
+    auto marker = std::uint8_t(m_buffer[m_pos]);
+    if (marker < 0x80 || marker >= 0xe0) {
+        value = std::int8_t(marker);
+        size = 1;
+        return true;
+    }
 
-    next();
+    switch (marker) {
+        case 0xcc:
+            size = 2;
+            check_available(size);
+            value = load<std::uint8_t>(m_buffer, m_pos + 1);
+            return true;
+        case 0xcd:
+            size = 3;
+            check_available(size);
+            value = load<std::uint16_t>(m_buffer, m_pos + 1);
+            return true;
+        case 0xce:
+            size = 5;
+            check_available(size);
+            value = load<std::uint32_t>(m_buffer, m_pos + 1);
+            return true;
+        case 0xcf:
+            size = 9;
+            check_available(size);
+            value = std::int64_t(load<std::uint64_t>(m_buffer, m_pos + 1));
+            return true;
+        case 0xd0:
+            size = 2;
+            check_available(size);
+            value = load<std::int8_t>(m_buffer, m_pos + 1);
+            return true;
+        case 0xd1:
+            size = 3;
+            check_available(size);
+            value = load<std::int16_t>(m_buffer, m_pos + 1);
+            return true;
+        case 0xd2:
+            size = 5;
+            check_available(size);
+            value = load<std::int32_t>(m_buffer, m_pos + 1);
+            return true;
+        case 0xd3:
+            size = 9;
+            check_available(size);
+            value = load<std::int64_t>(m_buffer, m_pos + 1);
+            return true;
+        default:
+            return false;
+    }
 }
 
-bool reader::try_read_nil() {
-    if (m_current_val.data.type != MSGPACK_OBJECT_NIL)
+bool reader::peek_str(std::size_t &header, std::size_t &size) const {
+    auto marker = std::uint8_t(m_buffer[m_pos]);
+    if ((marker & 0xe0) == 0xa0) {
+        header = 1;
+        size = marker & 0x1f;
+    } else if (marker == 0xd9) {
+        header = 2;
+        check_available(header);
+        size = load<std::uint8_t>(m_buffer, m_pos + 1);
+    } else if (marker == 0xda) {
+        header = 3;
+        check_available(header);
+        size = load<std::uint16_t>(m_buffer, m_pos + 1);
+    } else if (marker == 0xdb) {
+        header = 5;
+        check_available(header);
+        size = load<std::uint32_t>(m_buffer, m_pos + 1);
+    } else {
         return false;
+    }
 
-    next();
+    check_available(header + size);
     return true;
 }
 
-void reader::next() {
+bool reader::read_bool() {
+    check_data_in_stream();
+
+    auto marker = std::uint8_t(m_buffer[m_pos]);
+    if (marker != 0xc2 && marker != 0xc3)
+        throw ignite_error("The value in stream is not a bool : " + std::to_string(marker));
+
+    ++m_pos;
+    return marker == 0xc3;
+}
+
+std::string reader::read_string() {
+    check_data_in_stream();
+
+    std::size_t header;
+    std::size_t size;
+    if (!peek_str(header, size))
+        throw ignite_error("The value in stream is not a string : " + std::to_string(std::uint8_t(m_buffer[m_pos])));
+
+    auto data = reinterpret_cast<const char *>(m_buffer.data() + m_pos + header);
+    m_pos += header + size;
+
+    return {data, size};
+}
+
+uuid reader::read_uuid() {
+    check_data_in_stream();
+
+    // UUID is always encoded as fixext 16.
+    auto marker = std::uint8_t(m_buffer[m_pos]);
+    if (marker != 0xd8)
+        throw ignite_error("The value in stream is not a UUID : " + std::to_string(marker));
+
+    check_available(18);
+    auto type = std::int8_t(m_buffer[m_pos + 1]);
+    if (type != std::int8_t(extension_type::UUID))
+        throw ignite_error("The value in stream is not a UUID : " + std::to_string(type));
+
+    auto data = m_buffer.data() + m_pos + 2;
+    m_pos += 18;
+
+    auto msb = detail::bytes::load<detail::endian::LITTLE, int64_t>(data);
+    auto lsb = detail::bytes::load<detail::endian::LITTLE, int64_t>(data + 8);
+
+    return {msb, lsb};
+}
+
+bytes_view reader::read_binary() {
     check_data_in_stream();
 
-    m_offset = m_offset_next;
-    m_move_res = msgpack_unpack_next(
-        &m_current_val, reinterpret_cast<const char *>(m_buffer.data()), m_buffer.size(), &m_offset_next);
+    std::size_t header;
+    std::size_t size;
+    auto marker = std::uint8_t(m_buffer[m_pos]);
+    switch (marker) {
+        case 0xc4:
+            header = 2;
+            check_available(header);
+            size = load<std::uint8_t>(m_buffer, m_pos + 1);
+            break;
+        case 0xc5:
+            header = 3;
+            check_available(header);
+            size = load<std::uint16_t>(m_buffer, m_pos + 1);
+            break;
+        case 0xc6:
+            header = 5;
+            check_available(header);
+            size = load<std::uint32_t>(m_buffer, m_pos + 1);
+            break;
+        default:
+            throw ignite_error("The value in stream is not a Binary data : " + std::to_string(marker));
+    }
+
+    check_available(header + size);
+
+    bytes_view res{m_buffer.data() + m_pos + header, size};
+    m_pos += header + size;
+
+    return res;
+}
+
+bool reader::try_read_nil() {
+    if (m_pos >= m_buffer.size())
+        return true;
+
+    if (m_buffer[m_pos] != std::byte(0xc0))
+        return false;
+
+    ++m_pos;
+    return true;
+}
+
+void reader::skip() {
+    if (m_pos >= m_buffer.size())
+        return;
+
+    // Number of values left to skip, including the nested values of the skipped arrays and maps.
+    std::uint64_t left = 1;
+    while (left) {
+        --left;
+        check_data_in_stream();
+
+        auto marker = std::uint8_t(m_buffer[m_pos]);
+
+        // Size of the header and of the data which follows it.
+        std::size_t header = 1;
+        std::size_t size = 0;
+        if (marker < 0x80 || marker >= 0xe0) {
+            // Fixint.
+        } else if (marker < 0x90) {
+            left += std::uint64_t(marker & 0x0f) * 2;
+        } else if (marker < 0xa0) {
+            left += marker & 0x0f;
+        } else if (marker < 0xc0) {
+            size = marker & 0x1f;
+        } else {
+            switch (marker) {
+                case 0xc0: // Nil.
+                case 0xc2: // False.
+                case 0xc3: // True.
+                    break;
+                case 0xc4: // Bin 8.
+                case 0xd9: // Str 8.
+                    header = 2;
+                    check_available(header);
+                    size = load<std::uint8_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xc5: // Bin 16.
+                case 0xda: // Str 16.
+                    header = 3;
+                    check_available(header);
+                    size = load<std::uint16_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xc6: // Bin 32.
+                case 0xdb: // Str 32.
+                    header = 5;
+                    check_available(header);
+                    size = load<std::uint32_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xc7: // Ext 8.
+                    header = 3;
+                    check_available(header);
+                    size = load<std::uint8_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xc8: // Ext 16.
+                    header = 4;
+                    check_available(header);
+                    size = load<std::uint16_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xc9: // Ext 32.
+                    header = 6;
+                    check_available(header);
+                    size = load<std::uint32_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xca: // Float 32.
+                    size = 4;
+                    break;
+                case 0xcb: // Float 64.
+                    size = 8;
+                    break;
+                case 0xcc: // Uint 8.
+                case 0xd0: // Int 8.
+                    size = 1;
+                    break;
+                case 0xcd: // Uint 16.
+                case 0xd1: // Int 16.
+                    size = 2;
+                    break;
+                case 0xce: // Uint 32.
+                case 0xd2: // Int 32.
+                    size = 4;
+                    break;
+                case 0xcf: // Uint 64.
+                case 0xd3: // Int 64.
+                    size = 8;
+                    break;
+                case 0xd4: // Fixext 1.
+                    size = 2;
+                    break;
+                case 0xd5: // Fixext 2.
+                    size = 3;
+                    break;
+                case 0xd6: // Fixext 4.
+                    size = 5;
+                    break;
+                case 0xd7: // Fixext 8.
+                    size = 9;
+                    break;
+                case 0xd8: // Fixext 16.
+                    size = 17;
+                    break;
+                case 0xdc: // Array 16.
+                    header = 3;
+                    check_available(header);
+                    left += load<std::uint16_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xdd: // Array 32.
+                    header = 5;
+                    check_available(header);
+                    left += load<std::uint32_t>(m_buffer, m_pos + 1);
+                    break;
+                case 0xde: // Map 16.
+                    header = 3;
+                    check_available(header);
+                    left += std::uint64_t(load<std::uint16_t>(m_buffer, m_pos + 1)) * 2;
+                    break;
+                case 0xdf: // Map 32.
+                    header = 5;
+                    check_available(header);
+                    left += std::uint64_t(load<std::uint32_t>(m_buffer, m_pos + 1)) * 2;
+                    break;
+                default:
+                    throw ignite_error("Unexpected value in stream : " + std::to_string(marker));
+            }
+        }
+
+        check_available(header + size);
+        m_pos += header + size;
+    }
 }
 
 } // namespace ignite::protocol
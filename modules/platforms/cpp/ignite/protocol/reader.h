@@ -22,15 +22,20 @@
 #include <ignite/common/uuid.h>
 #include <ignite/protocol/utils.h>
 
-#include <msgpack.h>
-
 #include <cstdint>
 #include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
 
 namespace ignite::protocol {
 
 /**
  * Reader.
+ *
+ * Decodes MessagePack values right from the buffer: the type is determined by the first byte of the value, and
+ * strings and binary data are taken from the buffer in place, so no intermediate objects are created.
  */
 class reader {
 public:
@@ -46,12 +51,11 @@ public:
      *
      * @param buffer Buffer.
      */
-    explicit reader(bytes_view buffer);
+    explicit reader(bytes_view buffer)
+        : m_buffer(buffer) {}
 
-    /**
-     * Destructor.
-     */
-    ~reader() { msgpack_unpacked_destroy(&m_current_val); }
+    // Default
+    ~reader() = default;
 
     /**
      * Read object of type T from msgpack stream.
@@ -62,12 +66,17 @@ public:
      */
     template<typename T>
     [[nodiscard]] T read_object() {
-        check_data_in_stream();
-
-        auto res = unpack_object<T>(m_current_val.data);
-        next();
-
-        return res;
+        if constexpr (std::is_same_v<T, bool>) {
+            return read_bool();
+        } else if constexpr (std::is_integral_v<T>) {
+            return read_integer<T>();
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            return read_string();
+        } else if constexpr (std::is_same_v<T, uuid>) {
+            return read_uuid();
+        } else {
+            static_assert(sizeof(T) == 0, "Unpacking is not implemented for the type");
+        }
     }
 
     /**
@@ -81,11 +90,23 @@ public:
     [[nodiscard]] std::optional<T> try_read_object() {
         check_data_in_stream();
 
-        auto res = try_unpack_object<T>(m_current_val.data);
-        if (res)
-            next();
-
-        return res;
+        if constexpr (std::is_same_v<T, std::string>) {
+            std::size_t header;
+            std::size_t size;
+            if (!peek_str(header, size))
+                return std::nullopt;
+
+            return read_string();
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            std::int64_t value;
+            std::size_t size;
+            if (!peek_integer(value, size))
+                return std::nullopt;
+
+            return read_integer<T>();
+        } else {
+            static_assert(sizeof(T) == 0, "Unpacking is not implemented for the type");
+        }
     }
 
     /**
@@ -275,14 +296,14 @@ public:
      *
      * @return Value.
      */
-    [[nodiscard]] bool read_bool() { return read_object<bool>(); }
+    [[nodiscard]] bool read_bool();
 
     /**
      * Read string.
      *
      * @return String value.
      */
-    [[nodiscard]] std::string read_string() { return read_object<std::string>(); }
+    [[nodiscard]] std::string read_string();
 
     /**
      * Read string.
@@ -296,30 +317,27 @@ public:
      *
      * @return UUID value.
      */
-    [[nodiscard]] uuid read_uuid() { return read_object<uuid>(); }
+    [[nodiscard]] uuid read_uuid();
 
     /**
      * Read array.
      *
      * @return Binary data view.
      */
-    [[nodiscard]] bytes_view read_binary() {
-        auto res = unpack_binary(m_current_val.data);
-        next();
-        return res;
-    }
+    [[nodiscard]] bytes_view read_binary();
 
     /**
-     * If the next value is Nil, read it and move reader to the next position.
+     * If the next value is Nil, read it and move reader to the next position. The end of the stream is treated as
+     * nil, so the optional values at the end of a message may be omitted.
      *
      * @return @c true if the value was nil.
      */
     bool try_read_nil();
 
     /**
-     * Skip next value.
+     * Skip next value. Nested values of arrays and maps are skipped as well. Does nothing at the end of the stream.
      */
-    void skip() { next(); }
+    void skip();
 
     /**
      * Skip next value.
@@ -335,36 +353,102 @@ public:
      *
      * @return Current position in memory.
      */
-    [[nodiscard]] size_t position() const { return m_offset; }
+    [[nodiscard]] size_t position() const { return m_pos; }
 
 private:
     /**
-     * Move to the next value.
+     * Read integer.
+     *
+     * @tparam T Integer type.
+     * @return Value.
+     * @throw ignite_error if there is no integer in the stream or it does not fit the type.
      */
-    void next();
+    template<typename T>
+    [[nodiscard]] T read_integer() {
+        check_data_in_stream();
+
+        // Positive fixint is the most common case.
+        auto marker = std::uint8_t(m_buffer[m_pos]);
+        if (marker < 0x80) {
+            ++m_pos;
+            return T(marker);
+        }
+
+        std::int64_t value;
+        std::size_t size;
+        if (!peek_integer(value, size))
+            throw ignite_error("The value in stream is not an integer number : " + std::to_string(marker));
+
+        if constexpr (std::is_same_v<T, std::int64_t>) {
+            m_pos += size;
+            return value;
+        } else if constexpr (std::is_unsigned_v<T>) {
+            // Values of the uint 64 format do not fit int64 and are negative here.
+            if (value < 0 && marker != 0xcf)
+                throw ignite_error("The value in stream is not a positive integer number : " + std::to_string(value));
+
+            // Compared as unsigned, as the maximum of uint64 does not fit int64.
+            auto unsigned_value = std::uint64_t(value);
+            if (unsigned_value > std::numeric_limits<T>::max()) {
+                throw ignite_error(
+                    "The number in stream is too large to fit in type: " + std::to_string(unsigned_value));
+            }
+
+            m_pos += size;
+            return T(unsigned_value);
+        } else {
+            if (value > std::int64_t(std::numeric_limits<T>::max()) || (value < 0 && marker == 0xcf))
+                throw ignite_error("The number in stream is too large to fit in type: " + std::to_string(value));
+
+            if (value < std::int64_t(std::numeric_limits<T>::min()))
+                throw ignite_error("The number in stream is too small to fit in type: " + std::to_string(value));
+
+            m_pos += size;
+            return T(value);
+        }
+    }
+
+    /**
+     * Decode integer at the current position without moving.
+     *
+     * @param value Value. Values of the uint 64 format are converted as is.
+     * @param size Size of the encoded value.
+     * @return @c true if there is an integer at the current position.
+     */
+    bool peek_integer(std::int64_t &value, std::size_t &size) const;
+
+    /**
+     * Decode string header at the current position without moving.
+     *
+     * @param header Header size.
+     * @param size String size.
+     * @return @c true if there is a string at the current position.
+     */
+    bool peek_str(std::size_t &header, std::size_t &size) const;
+
+    /**
+     * Check that the buffer has the specified number of bytes after the current position.
+     *
+     * @param size Number of bytes.
+     */
+    void check_available(std::size_t size) const {
+        if (m_buffer.size() - m_pos < size)
+            throw ignite_error("Unexpected end of data in stream");
+    }
 
     /**
      * Check whether there is a data in stream and throw ignite_error if there is none.
      */
     void check_data_in_stream() const {
-        if (m_move_res < 0)
+        if (m_pos >= m_buffer.size())
             throw ignite_error("No more data in stream");
     }
 
     /** Buffer. */
     bytes_view m_buffer;
 
-    /** Current value. */
-    msgpack_unpacked m_current_val;
-
-    /** Result of the last move operation. */
-    msgpack_unpack_return m_move_res;
-
-    /** Offset to next value. */
-    std::size_t m_offset_next{0};
-
-    /** Offset. */
-    std::size_t m_offset{0};
+    /** Position of the next value. */
+    std::size_t m_pos{0};
 };
 
 } // namespace ignite::protocol
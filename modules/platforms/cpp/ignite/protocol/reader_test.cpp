@@ -0,0 +1,226 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/protocol/reader.h"
+#include "ignite/protocol/writer.h"
+
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::protocol;
+
+namespace {
+
+/**
+ * Encode with the writer.
+ *
+ * @param func Function writing the values.
+ * @return Encoded data.
+ */
+std::vector<std::byte> encode(const std::function<void(writer &)> &func) {
+    std::vector<std::byte> data;
+    buffer_adapter buffer(data);
+    writer wr(buffer);
+    func(wr);
+
+    return data;
+}
+
+/**
+ * Make bytes.
+ *
+ * @param values Byte values.
+ * @return Bytes.
+ */
+std::vector<std::byte> bytes(std::initializer_list<int> values) {
+    std::vector<std::byte> res;
+    for (auto value : values)
+        res.push_back(std::byte(value));
+
+    return res;
+}
+
+} // namespace
+
+TEST(reader, integers) {
+    std::vector<std::int64_t> values{0, 1, 127, 128, 255, 256, 65535, 65536, std::numeric_limits<std::int32_t>::max(),
+        std::int64_t(std::numeric_limits<std::int32_t>::max()) + 1, std::numeric_limits<std::int64_t>::max(), -1, -32,
+        -33, -128, -129, -32768, -32769, std::numeric_limits<std::int32_t>::min(),
+        std::int64_t(std::numeric_limits<std::int32_t>::min()) - 1, std::numeric_limits<std::int64_t>::min()};
+
+    auto data = encode([&values](writer &wr) {
+        for (auto value : values)
+            wr.write(value);
+    });
+
+    reader rd(data);
+    for (auto value : values)
+        EXPECT_EQ(value, rd.read_int64());
+
+    EXPECT_EQ(data.size(), rd.position());
+}
+
+TEST(reader, integer_fits_type) {
+    auto data = encode([](writer &wr) {
+        wr.write(std::int32_t(300));
+        wr.write(std::int32_t(-5));
+    });
+
+    reader rd(data);
+    EXPECT_THROW((void) rd.read_int8(), ignite_error);
+    EXPECT_THROW((void) rd.read_uint8(), ignite_error);
+    EXPECT_EQ(300, rd.read_uint16());
+
+    EXPECT_THROW((void) rd.read_uint8(), ignite_error);
+    EXPECT_EQ(-5, rd.read_int8());
+}
+
+TEST(reader, unsigned_formats) {
+    auto data = bytes({0xcc, 0xff, 0xcd, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff});
+
+    reader rd(data);
+    EXPECT_EQ(255, rd.read_uint8());
+    EXPECT_EQ(65535, rd.read_uint16());
+    EXPECT_EQ(-1, rd.read_int64());
+}
+
+TEST(reader, uint64) {
+    auto data = bytes({0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0x05, 0xcf,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff});
+
+    reader rd(data);
+    EXPECT_EQ(std::numeric_limits<std::uint64_t>::max(), rd.read_object<std::uint64_t>());
+    EXPECT_EQ(std::numeric_limits<std::uint32_t>::max(), rd.read_object<std::uint64_t>());
+    EXPECT_EQ(5, rd.read_object<std::uint64_t>());
+
+    // Does not fit the smaller types, either signed or unsigned.
+    EXPECT_THROW((void) rd.read_object<std::uint32_t>(), ignite_error);
+    EXPECT_THROW((void) rd.read_int32(), ignite_error);
+    EXPECT_EQ(std::uint64_t(1) << 63, std::uint64_t(rd.read_int64()));
+
+    // Negative numbers do not fit.
+    EXPECT_THROW((void) rd.read_object<std::uint64_t>(), ignite_error);
+}
+
+TEST(reader, try_read) {
+    auto data = encode([](writer &wr) {
+        wr.write("abc");
+        wr.write(std::int32_t(42));
+    });
+
+    reader rd(data);
+    EXPECT_EQ(std::nullopt, rd.try_read_int32());
+    EXPECT_EQ(std::nullopt, rd.try_read_object<std::int64_t>());
+    EXPECT_EQ("abc", rd.try_read_object<std::string>());
+
+    EXPECT_EQ(std::nullopt, rd.try_read_object<std::string>());
+    EXPECT_EQ(42, rd.try_read_int32());
+
+    EXPECT_THROW((void) rd.try_read_int32(), ignite_error);
+}
+
+TEST(reader, strings) {
+    std::vector<std::string> values{"", "a", std::string(31, 'x'), std::string(32, 'y'), std::string(256, 'z'),
+        std::string(65536, 'w')};
+
+    auto data = encode([&values](writer &wr) {
+        for (auto &value : values)
+            wr.write(value);
+    });
+
+    reader rd(data);
+    for (auto &value : values)
+        EXPECT_EQ(value, rd.read_string());
+}
+
+TEST(reader, other_types) {
+    uuid id(0x0102030405060708, 0x090a0b0c0d0e0f10);
+    auto binary = bytes({1, 2, 3});
+
+    auto data = encode([&](writer &wr) {
+        wr.write_bool(true);
+        wr.write_bool(false);
+        wr.write(id);
+        wr.write_binary(binary);
+        wr.write_binary_empty();
+        wr.write("str");
+        wr.write_nil();
+        wr.write_nil();
+    });
+
+    reader rd(data);
+    EXPECT_TRUE(rd.read_bool());
+    EXPECT_FALSE(rd.read_bool());
+    EXPECT_EQ(id, rd.read_uuid());
+
+    auto view = rd.read_binary();
+    EXPECT_EQ(binary, std::vector<std::byte>(view.begin(), view.end()));
+    EXPECT_TRUE(rd.read_binary().empty());
+
+    EXPECT_FALSE(rd.try_read_nil());
+    EXPECT_EQ("str", rd.read_string_nullable());
+    EXPECT_TRUE(rd.try_read_nil());
+    EXPECT_EQ(std::nullopt, rd.read_string_nullable());
+}
+
+TEST(reader, skip) {
+    // Array [1, "ab", {1: nil}], float 64, fixext 4, ext 8 of 3 bytes and a map 16 with one string pair.
+    auto data = bytes({0x93, 0x01, 0xa2, 'a', 'b', 0x81, 0x01, 0xc0, 0xcb, 0, 0, 0, 0, 0, 0, 0, 0, 0xd6, 0x01, 0, 0,
+        0, 0, 0xc7, 0x03, 0x01, 0, 0, 0, 0xde, 0x00, 0x01, 0xa1, 'k', 0xa1, 'v', 0x2a});
+
+    reader rd(data);
+    rd.skip();
+    EXPECT_EQ(8, rd.position());
+
+    rd.skip(4);
+    EXPECT_EQ(42, rd.read_int32());
+    EXPECT_EQ(data.size(), rd.position());
+}
+
+TEST(reader, end_of_stream) {
+    auto data = encode([](writer &wr) { wr.write(std::int32_t(1)); });
+
+    reader rd(data);
+    EXPECT_EQ(1, rd.read_int32());
+
+    // Optional values at the end of a message may be omitted.
+    EXPECT_TRUE(rd.try_read_nil());
+    EXPECT_EQ(std::nullopt, rd.read_int32_nullable());
+    rd.skip();
+
+    EXPECT_THROW((void) rd.read_int32(), ignite_error);
+    EXPECT_THROW((void) rd.read_string(), ignite_error);
+}
+
+TEST(reader, truncated) {
+    auto str = bytes({0xa3, 'a', 'b'});
+    reader rd_str(str);
+    EXPECT_THROW((void) rd_str.read_string(), ignite_error);
+
+    auto num = bytes({0xcd, 0x01});
+    reader rd_num(num);
+    EXPECT_THROW((void) rd_num.read_int32(), ignite_error);
+
+    auto arr = bytes({0x92, 0x01});
+    reader rd_arr(arr);
+    EXPECT_THROW(rd_arr.skip(), ignite_error);
+}
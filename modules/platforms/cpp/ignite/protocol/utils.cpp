@@ -20,8 +20,6 @@
 
 #include "ignite/common/error_codes.h"
 
-#include <msgpack.h>
-
 #include <limits>
 #include <mutex>
 #include <random>
@@ -31,165 +29,6 @@
 namespace ignite::protocol {
 
 
-/**
- * Check if int value fits in @c T.
- *
- * @tparam T Int type to fit value to.
- * @param value Int value.
- */
-template<typename T>
-inline void check_int_fits(std::int64_t value) {
-    if (value > std::int64_t(std::numeric_limits<T>::max()))
-        throw ignite_error("The number in stream is too large to fit in type: " + std::to_string(value));
-
-    if (value < std::int64_t(std::numeric_limits<T>::min()))
-        throw ignite_error("The number in stream is too small to fit in type: " + std::to_string(value));
-}
-
-template<typename T>
-std::optional<T> try_unpack_int(const msgpack_object &object) {
-    static_assert(
-        std::numeric_limits<T>::is_integer && std::numeric_limits<T>::is_signed, "Type T is not a signed integer type");
-
-    auto i64_val = try_unpack_object<std::int64_t>(object);
-    if (!i64_val)
-        return std::nullopt;
-
-    check_int_fits<T>(*i64_val);
-    return T(*i64_val);
-}
-
-template<>
-std::optional<std::int64_t> try_unpack_object(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_NEGATIVE_INTEGER && object.type != MSGPACK_OBJECT_POSITIVE_INTEGER)
-        return std::nullopt;
-
-    return object.via.i64;
-}
-
-template<>
-std::optional<std::int32_t> try_unpack_object(const msgpack_object &object) {
-    return try_unpack_int<std::int32_t>(object);
-}
-
-template<>
-std::optional<std::string> try_unpack_object(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_STR)
-        return std::nullopt;
-
-    return std::string{object.via.str.ptr, object.via.str.size};
-}
-
-template<typename T>
-T unpack_int(const msgpack_object &object) {
-    static_assert(
-        std::numeric_limits<T>::is_integer && std::numeric_limits<T>::is_signed, "Type T is not a signed integer type");
-
-    auto i64_val = unpack_object<std::int64_t>(object);
-
-    check_int_fits<T>(i64_val);
-    return T(i64_val);
-}
-
-template<typename T>
-T unpack_uint(const msgpack_object &object) {
-    static_assert(std::numeric_limits<T>::is_integer && !std::numeric_limits<T>::is_signed,
-        "Type T is not a unsigned integer type");
-
-    auto u64_val = unpack_object<std::uint64_t>(object);
-
-    check_int_fits<T>(u64_val);
-    return T(u64_val);
-}
-
-template<>
-std::optional<std::string> unpack_nullable(const msgpack_object &object) {
-    if (object.type == MSGPACK_OBJECT_NIL)
-        return std::nullopt;
-
-    return unpack_object<std::string>(object);
-}
-
-template<>
-std::int64_t unpack_object(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_NEGATIVE_INTEGER && object.type != MSGPACK_OBJECT_POSITIVE_INTEGER)
-        throw ignite_error("The value in stream is not an integer number : " + std::to_string(object.type));
-
-    return object.via.i64;
-}
-
-template<>
-std::uint64_t unpack_object(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_POSITIVE_INTEGER)
-        throw ignite_error("The value in stream is not a positive integer number : " + std::to_string(object.type));
-
-    return object.via.u64;
-}
-
-template<>
-std::int32_t unpack_object(const msgpack_object &object) {
-    return unpack_int<std::int32_t>(object);
-}
-
-template<>
-std::int16_t unpack_object(const msgpack_object &object) {
-    return unpack_int<std::int16_t>(object);
-}
-
-template<>
-std::uint16_t unpack_object(const msgpack_object &object) {
-    return unpack_uint<std::uint16_t>(object);
-}
-
-template<>
-std::int8_t unpack_object(const msgpack_object &object) {
-    return unpack_int<std::int8_t>(object);
-}
-
-template<>
-std::uint8_t unpack_object(const msgpack_object &object) {
-    return unpack_uint<std::uint8_t>(object);
-}
-
-template<>
-std::string unpack_object(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_STR)
-        throw ignite_error("The value in stream is not a string : " + std::to_string(object.type));
-
-    return {object.via.str.ptr, object.via.str.size};
-}
-
-template<>
-uuid unpack_object(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_EXT && object.via.ext.type != std::int8_t(extension_type::UUID))
-        throw ignite_error("The value in stream is not a UUID : " + std::to_string(object.type));
-
-    if (object.via.ext.size != 16)
-        throw ignite_error("Unexpected UUID size: " + std::to_string(object.via.ext.size));
-
-    auto data = reinterpret_cast<const std::byte *>(object.via.ext.ptr);
-
-    auto msb = detail::bytes::load<detail::endian::LITTLE, int64_t>(data);
-    auto lsb = detail::bytes::load<detail::endian::LITTLE, int64_t>(data + 8);
-
-    return {msb, lsb};
-}
-
-template<>
-bool unpack_object(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_BOOLEAN)
-        throw ignite_error("The value in stream is not a bool : " + std::to_string(object.type));
-
-    return object.via.boolean;
-}
-
-bytes_view unpack_binary(const msgpack_object &object) {
-    if (object.type != MSGPACK_OBJECT_BIN)
-        throw ignite_error("The value in stream is not a Binary data : " + std::to_string(object.type));
-
-    return {reinterpret_cast<const std::byte *>(object.via.bin.ptr), object.via.bin.size};
-}
-
 uuid make_random_uuid() {
     static std::mutex randomMutex;
     static std::random_device rd;
@@ -468,8 +307,7 @@ void append_primitive_with_type(binary_tuple_builder &builder, const primitive &
     }
 }
 
-primitive read_next_column(binary_tuple_parser &parser, ignite_type typ, std::int32_t scale) {
-    auto val = parser.get_next();
+primitive read_column(bytes_view val, ignite_type typ, std::int32_t scale) {
     if (val.empty())
         return {};
 
@@ -517,4 +355,8 @@ primitive read_next_column(binary_tuple_parser &parser, ignite_type typ, std::in
     }
 }
 
+primitive read_next_column(binary_tuple_parser &parser, ignite_type typ, std::int32_t scale) {
+    return read_column(parser.get_next(), typ, scale);
+}
+
 } // namespace ignite::protocol
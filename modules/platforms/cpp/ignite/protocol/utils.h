@@ -33,8 +33,6 @@
 #include <cstddef>
 #include <cstdint>
 
-struct msgpack_object;
-
 namespace ignite::protocol {
 
 class reader;
@@ -52,166 +50,6 @@ constexpr const char* SQL_UPDATE_COUNTERS = "sql-update-counters";
 static constexpr std::array<std::byte, 4> MAGIC_BYTES = {
     std::byte('I'), std::byte('G'), std::byte('N'), std::byte('I')};
 
-template<typename T>
-[[nodiscard]] std::optional<T> try_unpack_object(const msgpack_object &) {
-    static_assert(sizeof(T) == 0, "Unpacking is not implemented for the type");
-}
-
-/**
- * Try unpack number.
- *
- * @param object MsgPack object.
- * @return Number or @c nullopt if the object is not a number.
- */
-template<>
-[[nodiscard]] std::optional<std::int64_t> try_unpack_object(const msgpack_object &object);
-
-/**
- * Try unpack number.
- *
- * @param object MsgPack object.
- * @return Number or @c nullopt if the object is not a number.
- */
-template<>
-[[nodiscard]] std::optional<std::int32_t> try_unpack_object(const msgpack_object &object);
-
-/**
- * Try unpack string.
- *
- * @param object MsgPack object.
- * @return String or @c nullopt if the object is not a string.
- */
-template<>
-[[nodiscard]] std::optional<std::string> try_unpack_object(const msgpack_object &object);
-
-template<typename T>
-[[nodiscard]] std::optional<T> unpack_nullable(const msgpack_object &) {
-    static_assert(sizeof(T) == 0, "Unpacking is not implemented for the type");
-}
-
-/**
- * Unpack string.
- *
- * @param object MsgPack object.
- * @return String of @c nullopt if the object is @c nil.
- * @throw ignite_error if the object is not a string.
- */
-template<>
-[[nodiscard]] std::optional<std::string> unpack_nullable(const msgpack_object &object);
-
-template<typename T>
-[[nodiscard]] T unpack_object(const msgpack_object &) {
-    static_assert(sizeof(T) == 0, "Unpacking is not implemented for the type");
-}
-
-/**
- * Unpack number.
- *
- * @param object MsgPack object.
- * @return Number.
- * @throw ignite_error if the object is not a number.
- */
-template<>
-[[nodiscard]] std::int64_t unpack_object(const msgpack_object &object);
-
-/**
- * Unpack number.
- *
- * @param object MsgPack object.
- * @return Number.
- * @throw ignite_error if the object is not a number.
- */
-template<>
-[[nodiscard]] std::uint64_t unpack_object(const msgpack_object &object);
-
-/**
- * Unpack number.
- *
- * @param object MsgPack object.
- * @return Number.
- * @throw ignite_error if the object is not a number.
- */
-template<>
-[[nodiscard]] std::int32_t unpack_object(const msgpack_object &object);
-
-/**
- * Unpack number.
- *
- * @param object MsgPack object.
- * @return Number.
- * @throw ignite_error if the object is not a number.
- */
-template<>
-[[nodiscard]] std::int16_t unpack_object(const msgpack_object &object);
-
-/**
- * Unpack number.
- *
- * @param object MsgPack object.
- * @return Number.
- * @throw ignite_error if the object is not a number.
- */
-template<>
-[[nodiscard]] std::uint16_t unpack_object(const msgpack_object &object);
-
-/**
- * Unpack number.
- *
- * @param object MsgPack object.
- * @return Number.
- * @throw ignite_error if the object is not a number.
- */
-template<>
-[[nodiscard]] std::int8_t unpack_object(const msgpack_object &object);
-
-/**
- * Unpack number.
- *
- * @param object MsgPack object.
- * @return Number.
- * @throw ignite_error if the object is not a number.
- */
-template<>
-[[nodiscard]] std::uint8_t unpack_object(const msgpack_object &object);
-
-/**
- * Unpack string.
- *
- * @param object MsgPack object.
- * @return String.
- * @throw ignite_error if the object is not a string.
- */
-template<>
-[[nodiscard]] std::string unpack_object(const msgpack_object &object);
-
-/**
- * Unpack UUID.
- *
- * @param object MsgPack object.
- * @return UUID.
- * @throw ignite_error if the object is not a UUID.
- */
-template<>
-[[nodiscard]] uuid unpack_object(const msgpack_object &object);
-
-/**
- * Unpack bool.
- *
- * @param object MsgPack object.
- * @return bool value.
- * @throw ignite_error if the object is not a bool.
- */
-template<>
-[[nodiscard]] bool unpack_object(const msgpack_object &object);
-
-/**
- * Get binary data.
- *
- * @param object Object.
- * @return Binary data view.
- */
-[[nodiscard]] bytes_view unpack_binary(const msgpack_object &object);
-
 /**
  * Make random UUID.
  *
@@ -275,6 +113,16 @@ void claim_primitive_with_type(binary_tuple_builder &builder, const primitive &v
  */
 void append_primitive_with_type(binary_tuple_builder &builder, const primitive &value);
 
+/**
+ * Read column value from a binary tuple element.
+ *
+ * @param val Binary tuple element.
+ * @param typ Column type.
+ * @param scale Column scale.
+ * @return Column value.
+ */
+[[nodiscard]] primitive read_column(bytes_view val, ignite_type typ, std::int32_t scale);
+
 /**
  * Read column value from binary tuple.
  *
@@ -17,22 +17,134 @@
 
 #include "ignite/protocol/writer.h"
 
+#include <limits>
+
 namespace ignite::protocol {
 
-int writer::write_callback(void *data, const char *buf, size_t len) {
-    if (!data)
-        return 0;
+namespace {
+
+/**
+ * Write value preceded by the marker.
+ *
+ * @tparam T Value type.
+ * @param buffer Buffer.
+ * @param marker Marker.
+ * @param value Value in big-endian byte order.
+ */
+template<typename T>
+void write_with_marker(buffer_adapter &buffer, std::uint8_t marker, T value) {
+    auto dst = buffer.extend(1 + sizeof(T));
+    dst[0] = std::byte(marker);
+    detail::bytes::store<detail::endian::BIG, T>(dst + 1, value);
+}
+
+/**
+ * Write header at the specified position of the buffer.
+ *
+ * @tparam T Size type.
+ * @param buffer Buffer.
+ * @param pos Header position.
+ * @param marker Marker.
+ * @param size Size in big-endian byte order.
+ */
+template<typename T>
+void write_header_at(buffer_adapter &buffer, std::size_t pos, std::uint8_t marker, T size) {
+    auto dst = buffer.get_buffer().data() + pos;
+    dst[0] = std::byte(marker);
+    detail::bytes::store<detail::endian::BIG, T>(dst + 1, size);
+}
+
+} // namespace
 
-    auto buffer = static_cast<buffer_adapter *>(data);
+void writer::write_integer_slow(std::int64_t value) {
+    if (value < 0) {
+        if (value >= std::numeric_limits<std::int8_t>::min())
+            write_with_marker(m_buffer, 0xd0, std::int8_t(value));
+        else if (value >= std::numeric_limits<std::int16_t>::min())
+            write_with_marker(m_buffer, 0xd1, std::int16_t(value));
+        else if (value >= std::numeric_limits<std::int32_t>::min())
+            write_with_marker(m_buffer, 0xd2, std::int32_t(value));
+        else
+            write_with_marker(m_buffer, 0xd3, value);
+
+        return;
+    }
+
+    if (value <= std::numeric_limits<std::uint8_t>::max())
+        write_with_marker(m_buffer, 0xcc, std::uint8_t(value));
+    else if (value <= std::numeric_limits<std::uint16_t>::max())
+        write_with_marker(m_buffer, 0xcd, std::uint16_t(value));
+    else if (value <= std::numeric_limits<std::uint32_t>::max())
+        write_with_marker(m_buffer, 0xce, std::uint32_t(value));
+    else
+        write_with_marker(m_buffer, 0xcf, std::uint64_t(value));
+}
+
+void writer::write_str_header(std::size_t size) {
+    if (size < 32)
+        write_marker(std::uint8_t(0xa0 | size));
+    else if (size <= std::numeric_limits<std::uint8_t>::max())
+        write_with_marker(m_buffer, 0xd9, std::uint8_t(size));
+    else if (size <= std::numeric_limits<std::uint16_t>::max())
+        write_with_marker(m_buffer, 0xda, std::uint16_t(size));
+    else
+        write_with_marker(m_buffer, 0xdb, std::uint32_t(size));
+}
+
+void writer::write_bin_header(std::size_t size) {
+    if (size <= std::numeric_limits<std::uint8_t>::max())
+        write_with_marker(m_buffer, 0xc4, std::uint8_t(size));
+    else if (size <= std::numeric_limits<std::uint16_t>::max())
+        write_with_marker(m_buffer, 0xc5, std::uint16_t(size));
+    else
+        write_with_marker(m_buffer, 0xc6, std::uint32_t(size));
+}
+
+void writer::finish_binary_tuple(binary_tuple_builder &builder) {
+    auto size = builder.get_tuple_size();
+
+    // The buffer is resized by the builder, so the header position is only valid after the tuple is finished.
+    if (size <= std::numeric_limits<std::uint8_t>::max()) {
+        auto pos = builder.finish(2);
+        write_header_at(m_buffer, pos, 0xc4, std::uint8_t(size));
+    } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+        auto pos = builder.finish(3);
+        write_header_at(m_buffer, pos, 0xc5, std::uint16_t(size));
+    } else {
+        auto pos = builder.finish(5);
+        write_header_at(m_buffer, pos, 0xc6, std::uint32_t(size));
+    }
+}
 
-    // We do not support messages larger than MAX_INT32
-    if (buffer->data().size() + len > std::size_t(std::numeric_limits<int32_t>::max()))
-        return -1;
+void writer::write_ext_header(std::size_t size, std::int8_t type) {
+    switch (size) {
+        case 1:
+            write_with_marker(m_buffer, 0xd4, type);
+            return;
+        case 2:
+            write_with_marker(m_buffer, 0xd5, type);
+            return;
+        case 4:
+            write_with_marker(m_buffer, 0xd6, type);
+            return;
+        case 8:
+            write_with_marker(m_buffer, 0xd7, type);
+            return;
+        case 16:
+            write_with_marker(m_buffer, 0xd8, type);
+            return;
+        default:
+            break;
+    }
 
-    auto bytes = reinterpret_cast<const std::byte *>(buf);
-    buffer->write_raw(bytes_view{bytes, len});
+    if (size <= std::numeric_limits<std::uint8_t>::max())
+        write_with_marker(m_buffer, 0xc7, std::uint8_t(size));
+    else if (size <= std::numeric_limits<std::uint16_t>::max())
+        write_with_marker(m_buffer, 0xc8, std::uint16_t(size));
+    else
+        write_with_marker(m_buffer, 0xc9, std::uint32_t(size));
 
-    return 0;
+    write_marker(std::uint8_t(type));
 }
 
 } // namespace ignite::protocol
@@ -23,18 +23,21 @@
 #include "ignite/protocol/bitset_span.h"
 #include "ignite/protocol/buffer_adapter.h"
 #include "ignite/protocol/extension_types.h"
+#include "ignite/tuple/binary_tuple_builder.h"
 
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <map>
-#include <memory>
-#include <msgpack.h>
 #include <string_view>
 
 namespace ignite::protocol {
 
 /**
  * Writer.
+ *
+ * Encodes values with MessagePack straight into the buffer. The most common values, such as small integers and short
+ * strings, are encoded inline.
  */
 class writer {
 public:
@@ -54,45 +57,54 @@ public:
      * @param buffer Buffer.
      */
     explicit writer(buffer_adapter &buffer)
-        : m_buffer(buffer)
-        , m_packer(msgpack_packer_new(&m_buffer, write_callback), msgpack_packer_free) {
-        assert(m_packer.get());
-    }
+        : m_buffer(buffer) {}
 
     /**
      * Write int value.
      *
      * @param value Value to write.
      */
-    void write(std::int8_t value) { msgpack_pack_int8(m_packer.get(), value); }
+    void write(std::int8_t value) { write_integer(value); }
 
     /**
      * Write int value.
      *
      * @param value Value to write.
      */
-    void write(std::int16_t value) { msgpack_pack_int16(m_packer.get(), value); }
+    void write(std::int16_t value) { write_integer(value); }
 
     /**
      * Write int value.
      *
      * @param value Value to write.
      */
-    void write(std::int32_t value) { msgpack_pack_int32(m_packer.get(), value); }
+    void write(std::int32_t value) { write_integer(value); }
 
     /**
      * Write int value.
      *
      * @param value Value to write.
      */
-    void write(std::int64_t value) { msgpack_pack_int64(m_packer.get(), value); }
+    void write(std::int64_t value) { write_integer(value); }
 
     /**
      * Write string value.
      *
      * @param value Value to write.
      */
-    void write(std::string_view value) { msgpack_pack_str_with_body(m_packer.get(), value.data(), value.size()); }
+    void write(std::string_view value) {
+        if (value.size() < 32) {
+            auto dst = m_buffer.extend(1 + value.size());
+            dst[0] = std::byte(0xa0 | value.size());
+            if (!value.empty())
+                std::memcpy(dst + 1, value.data(), value.size());
+
+            return;
+        }
+
+        write_str_header(value.size());
+        write_raw({reinterpret_cast<const std::byte *>(value.data()), value.size()});
+    }
 
     /**
      * Write UUID value.
@@ -100,34 +112,62 @@ public:
      * @param value Value to write.
      */
     void write(uuid value) {
-        std::byte data[16];
-        detail::bytes::store<detail::endian::LITTLE, std::int64_t>(&data[0], value.get_most_significant_bits());
-        detail::bytes::store<detail::endian::LITTLE, std::int64_t>(&data[8], value.get_least_significant_bits());
-
-        msgpack_pack_ext_with_body(m_packer.get(), &data, 16, std::int8_t(extension_type::UUID));
+        // fixext 16.
+        auto dst = m_buffer.extend(18);
+        dst[0] = std::byte(0xd8);
+        dst[1] = std::byte(extension_type::UUID);
+        detail::bytes::store<detail::endian::LITTLE, std::int64_t>(dst + 2, value.get_most_significant_bits());
+        detail::bytes::store<detail::endian::LITTLE, std::int64_t>(dst + 10, value.get_least_significant_bits());
     }
 
     /**
      * Write nil value.
      */
-    void write_nil() { msgpack_pack_nil(m_packer.get()); }
+    void write_nil() { write_marker(0xc0); }
+
+    /**
+     * Write data which is already encoded.
+     *
+     * @param data Encoded data.
+     */
+    void write_raw(bytes_view data) { m_buffer.write_raw(data); }
 
     /**
      * Write empty binary data.
      */
-    void write_binary_empty() { msgpack_pack_bin(m_packer.get(), 0); }
+    void write_binary_empty() {
+        auto dst = m_buffer.extend(2);
+        dst[0] = std::byte(0xc4);
+        dst[1] = std::byte(0);
+    }
 
     /**
      * Write binary data.
      *
      * @param data Binary data to pack.
      */
-    void write_binary(bytes_view data) { msgpack_pack_bin_with_body(m_packer.get(), data.data(), data.size()); }
+    void write_binary(bytes_view data) {
+        write_bin_header(data.size());
+        write_raw(data);
+    }
+
+    /**
+     * Write binary tuple as binary data. The tuple is built in place, right after the binary header.
+     *
+     * @param builder Tuple builder. Reusing it for the tuples of a batch avoids moving the data.
+     * @param append Function which appends all the tuple elements to the builder.
+     */
+    template<typename F>
+    void write_binary_tuple(binary_tuple_builder &builder, F &&append) {
+        builder.start_single_pass(m_buffer.get_buffer());
+        append(builder);
+        finish_binary_tuple(builder);
+    }
 
     /**
      * Write empty map.
      */
-    void write_map_empty() { msgpack_pack_map(m_packer.get(), 0); }
+    void write_map_empty() { write_marker(0x80); }
 
     /**
      * Write map.
@@ -148,7 +188,8 @@ public:
      * @param data Bitset to write.
      */
     void write_bitset(bytes_view data) {
-        msgpack_pack_ext_with_body(m_packer.get(), data.data(), data.size(), std::int8_t(extension_type::BITMASK));
+        write_ext_header(data.size(), std::int8_t(extension_type::BITMASK));
+        write_raw(data);
     }
 
     /**
@@ -156,30 +197,69 @@ public:
      *
      * @param value Value to write.
      */
-    void write_bool(bool value) {
-        if (value) {
-            msgpack_pack_true(m_packer.get());
-        } else {
-            msgpack_pack_false(m_packer.get());
+    void write_bool(bool value) { write_marker(value ? 0xc3 : 0xc2); }
+
+private:
+    /**
+     * Write single byte value.
+     *
+     * @param marker Value.
+     */
+    void write_marker(std::uint8_t marker) { *m_buffer.extend(1) = std::byte(marker); }
+
+    /**
+     * Write integer with the shortest encoding.
+     *
+     * @param value Value to write.
+     */
+    void write_integer(std::int64_t value) {
+        // Positive and negative fixint are the value itself.
+        if (value >= -32 && value < 128) {
+            write_marker(std::uint8_t(value));
+            return;
         }
+
+        write_integer_slow(value);
     }
 
-private:
     /**
-     * Write callback.
+     * Write integer which does not fit fixint.
+     *
+     * @param value Value to write.
+     */
+    void write_integer_slow(std::int64_t value);
+
+    /**
+     * Write string header.
+     *
+     * @param size String size in bytes.
+     */
+    void write_str_header(std::size_t size);
+
+    /**
+     * Write binary header.
+     *
+     * @param size Binary data size in bytes.
+     */
+    void write_bin_header(std::size_t size);
+
+    /**
+     * Finish binary tuple built in place and write the binary header in front of it.
+     *
+     * @param builder Tuple builder.
+     */
+    void finish_binary_tuple(binary_tuple_builder &builder);
+
+    /**
+     * Write extension header.
      *
-     * @param data Pointer to the instance.
-     * @param buf Data to write.
-     * @param len Data length.
-     * @return Write result.
+     * @param size Extension data size in bytes.
+     * @param type Extension type.
      */
-    static int write_callback(void *data, const char *buf, size_t len);
+    void write_ext_header(std::size_t size, std::int8_t type);
 
     /** Buffer adapter. */
     buffer_adapter &m_buffer;
-
-    /** Packer. */
-    std::unique_ptr<msgpack_packer, void (*)(msgpack_packer *)> m_packer;
 };
 
 /**
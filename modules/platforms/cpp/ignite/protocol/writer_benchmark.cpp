@@ -0,0 +1,107 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/protocol/client_operation.h"
+#include "ignite/protocol/writer.h"
+
+#include <gtest/gtest.h>
+
+#include <msgpack.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::protocol;
+
+namespace {
+
+/** Number of encoded requests per measurement. */
+constexpr std::int64_t REQUESTS = 1'000'000;
+
+/** Binary tuple of a two column record. */
+const std::vector<std::byte> TUPLE(32, std::byte{42});
+
+/**
+ * Write callback of the msgpack-c packer, the way the writer used to write.
+ *
+ * @param data Buffer adapter.
+ * @param buf Data to write.
+ * @param len Data length.
+ * @return Write result.
+ */
+int write_callback(void *data, const char *buf, size_t len) {
+    static_cast<buffer_adapter *>(data)->write_raw({reinterpret_cast<const std::byte *>(buf), len});
+
+    return 0;
+}
+
+/**
+ * Measure encoding of TUPLE_UPSERT requests.
+ *
+ * @param name Name to report.
+ * @param encode Function encoding a request with the specified ID into the buffer.
+ */
+template<typename F>
+void measure(const char *name, F encode) {
+    // The buffer is reused, the same way pooled request buffers are.
+    std::vector<std::byte> message;
+    message.reserve(256);
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::int64_t req_id = 0; req_id < REQUESTS; ++req_id) {
+        message.clear();
+
+        buffer_adapter buffer(message);
+        buffer.reserve_length_header();
+        encode(buffer, req_id);
+        buffer.write_length_header();
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    std::cout << name << ": " << double(ns) / REQUESTS << " ns per request, " << message.size() << " bytes"
+              << std::endl;
+
+    EXPECT_FALSE(message.empty());
+}
+
+} // namespace
+
+TEST(writer_benchmark, tuple_upsert) {
+    measure("writer", [](buffer_adapter &buffer, std::int64_t req_id) {
+        writer wr(buffer);
+        wr.write(std::int32_t(client_operation::TUPLE_UPSERT));
+        wr.write(req_id);
+        wr.write(std::int32_t(1001));
+        wr.write_nil();
+        wr.write(std::int32_t(3));
+        wr.write_binary(TUPLE);
+    });
+
+    measure("msgpack-c packer", [](buffer_adapter &buffer, std::int64_t req_id) {
+        msgpack_packer *packer = msgpack_packer_new(&buffer, write_callback);
+        msgpack_pack_int32(packer, std::int32_t(client_operation::TUPLE_UPSERT));
+        msgpack_pack_int64(packer, req_id);
+        msgpack_pack_int32(packer, 1001);
+        msgpack_pack_nil(packer);
+        msgpack_pack_int32(packer, 3);
+        msgpack_pack_bin_with_body(packer, TUPLE.data(), TUPLE.size());
+        msgpack_packer_free(packer);
+    });
+}
@@ -0,0 +1,226 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/protocol/writer.h"
+
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace ignite;
+using namespace ignite::protocol;
+
+namespace {
+
+/**
+ * Encode with the writer.
+ *
+ * @param func Function writing the values.
+ * @return Encoded data.
+ */
+std::vector<std::byte> encode(const std::function<void(writer &)> &func) {
+    std::vector<std::byte> data;
+    buffer_adapter buffer(data);
+    writer wr(buffer);
+    func(wr);
+
+    return data;
+}
+
+/**
+ * Make bytes.
+ *
+ * @param values Byte values.
+ * @return Bytes.
+ */
+std::vector<std::byte> bytes(std::initializer_list<int> values) {
+    std::vector<std::byte> res;
+    for (auto value : values)
+        res.push_back(std::byte(value));
+
+    return res;
+}
+
+/**
+ * Get the header of encoded data.
+ *
+ * @param data Encoded data.
+ * @param size Header size.
+ * @return Header.
+ */
+std::vector<std::byte> header(const std::vector<std::byte> &data, std::size_t size) {
+    return {data.begin(), data.begin() + std::ptrdiff_t(size)};
+}
+
+} // namespace
+
+TEST(writer, fixint) {
+    EXPECT_EQ(bytes({0x00}), encode([](writer &wr) { wr.write(std::int8_t(0)); }));
+    EXPECT_EQ(bytes({0x7f}), encode([](writer &wr) { wr.write(std::int32_t(127)); }));
+    EXPECT_EQ(bytes({0xff}), encode([](writer &wr) { wr.write(std::int16_t(-1)); }));
+    EXPECT_EQ(bytes({0xe0}), encode([](writer &wr) { wr.write(std::int64_t(-32)); }));
+}
+
+TEST(writer, unsigned_int) {
+    EXPECT_EQ(bytes({0xcc, 0x80}), encode([](writer &wr) { wr.write(std::int16_t(128)); }));
+    EXPECT_EQ(bytes({0xcc, 0xff}), encode([](writer &wr) { wr.write(std::int32_t(255)); }));
+    EXPECT_EQ(bytes({0xcd, 0x01, 0x00}), encode([](writer &wr) { wr.write(std::int32_t(256)); }));
+    EXPECT_EQ(bytes({0xcd, 0xff, 0xff}), encode([](writer &wr) { wr.write(std::int32_t(65535)); }));
+    EXPECT_EQ(bytes({0xce, 0x00, 0x01, 0x00, 0x00}), encode([](writer &wr) { wr.write(std::int32_t(65536)); }));
+    EXPECT_EQ(bytes({0xce, 0x7f, 0xff, 0xff, 0xff}),
+        encode([](writer &wr) { wr.write(std::numeric_limits<std::int32_t>::max()); }));
+    EXPECT_EQ(bytes({0xcf, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}),
+        encode([](writer &wr) { wr.write(std::int64_t(0x100000000)); }));
+    EXPECT_EQ(bytes({0xcf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff}),
+        encode([](writer &wr) { wr.write(std::numeric_limits<std::int64_t>::max()); }));
+}
+
+TEST(writer, signed_int) {
+    EXPECT_EQ(bytes({0xd0, 0xdf}), encode([](writer &wr) { wr.write(std::int8_t(-33)); }));
+    EXPECT_EQ(bytes({0xd0, 0x80}), encode([](writer &wr) { wr.write(std::int8_t(-128)); }));
+    EXPECT_EQ(bytes({0xd1, 0xff, 0x7f}), encode([](writer &wr) { wr.write(std::int16_t(-129)); }));
+    EXPECT_EQ(bytes({0xd1, 0x80, 0x00}), encode([](writer &wr) { wr.write(std::int32_t(-32768)); }));
+    EXPECT_EQ(bytes({0xd2, 0xff, 0xff, 0x7f, 0xff}), encode([](writer &wr) { wr.write(std::int32_t(-32769)); }));
+    EXPECT_EQ(bytes({0xd2, 0x80, 0x00, 0x00, 0x00}),
+        encode([](writer &wr) { wr.write(std::numeric_limits<std::int32_t>::min()); }));
+    EXPECT_EQ(bytes({0xd3, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff}),
+        encode([](writer &wr) { wr.write(std::int64_t(std::numeric_limits<std::int32_t>::min()) - 1); }));
+    EXPECT_EQ(bytes({0xd3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}),
+        encode([](writer &wr) { wr.write(std::numeric_limits<std::int64_t>::min()); }));
+}
+
+TEST(writer, string) {
+    EXPECT_EQ(bytes({0xa0}), encode([](writer &wr) { wr.write(std::string_view()); }));
+    EXPECT_EQ(bytes({0xa3, 'a', 'b', 'c'}), encode([](writer &wr) { wr.write("abc"); }));
+
+    std::string s31(31, 'x');
+    auto data = encode([&s31](writer &wr) { wr.write(s31); });
+    EXPECT_EQ(32, data.size());
+    EXPECT_EQ(bytes({0xbf}), header(data, 1));
+
+    std::string s32(32, 'x');
+    data = encode([&s32](writer &wr) { wr.write(s32); });
+    EXPECT_EQ(34, data.size());
+    EXPECT_EQ(bytes({0xd9, 32}), header(data, 2));
+
+    std::string s256(256, 'x');
+    data = encode([&s256](writer &wr) { wr.write(s256); });
+    EXPECT_EQ(259, data.size());
+    EXPECT_EQ(bytes({0xda, 0x01, 0x00}), header(data, 3));
+
+    std::string s65536(65536, 'x');
+    data = encode([&s65536](writer &wr) { wr.write(s65536); });
+    EXPECT_EQ(65541, data.size());
+    EXPECT_EQ(bytes({0xdb, 0x00, 0x01, 0x00, 0x00}), header(data, 5));
+    EXPECT_EQ(std::byte('x'), data.back());
+}
+
+TEST(writer, binary) {
+    EXPECT_EQ(bytes({0xc4, 0x00}), encode([](writer &wr) { wr.write_binary_empty(); }));
+    EXPECT_EQ(bytes({0xc4, 0x00}), encode([](writer &wr) { wr.write_binary({}); }));
+
+    auto payload = bytes({1, 2, 3});
+    EXPECT_EQ(bytes({0xc4, 0x03, 1, 2, 3}), encode([&payload](writer &wr) { wr.write_binary(payload); }));
+
+    std::vector<std::byte> large(300, std::byte{7});
+    auto data = encode([&large](writer &wr) { wr.write_binary(large); });
+    EXPECT_EQ(303, data.size());
+    EXPECT_EQ(bytes({0xc5, 0x01, 0x2c}), header(data, 3));
+
+    std::vector<std::byte> huge(70000, std::byte{7});
+    data = encode([&huge](writer &wr) { wr.write_binary(huge); });
+    EXPECT_EQ(70005, data.size());
+    EXPECT_EQ(bytes({0xc6, 0x00, 0x01, 0x11, 0x70}), header(data, 5));
+}
+
+TEST(writer, binary_tuple) {
+    binary_tuple_builder two_pass(3);
+    binary_tuple_builder single_pass(3);
+
+    // Tuples of different sizes written in a row make the builder guess the layout wrong.
+    std::vector<std::size_t> lengths{0, 10, 300, 20, 70000, 70000, 5, 5};
+
+    auto expected = encode([&](writer &wr) {
+        for (auto len : lengths) {
+            std::string str(len, 'x');
+
+            two_pass.start();
+            two_pass.claim_int32(std::int32_t(len));
+            two_pass.claim_varlen(str);
+            two_pass.claim_null();
+            two_pass.layout();
+            two_pass.append_int32(std::int32_t(len));
+            two_pass.append_varlen(str);
+            two_pass.append_null();
+
+            wr.write_binary(two_pass.build());
+            wr.write_nil();
+        }
+    });
+
+    auto actual = encode([&](writer &wr) {
+        for (auto len : lengths) {
+            std::string str(len, 'x');
+
+            wr.write_binary_tuple(single_pass, [&](binary_tuple_builder &builder) {
+                builder.append_int32(std::int32_t(len));
+                builder.append_varlen(str);
+                builder.append_null();
+            });
+            wr.write_nil();
+        }
+    });
+
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(writer, extension) {
+    auto bitset1 = bytes({0x05});
+    EXPECT_EQ(bytes({0xd4, int(extension_type::BITMASK), 0x05}),
+        encode([&bitset1](writer &wr) { wr.write_bitset(bitset1); }));
+
+    auto bitset3 = bytes({1, 2, 3});
+    EXPECT_EQ(bytes({0xc7, 0x03, int(extension_type::BITMASK), 1, 2, 3}),
+        encode([&bitset3](writer &wr) { wr.write_bitset(bitset3); }));
+
+    auto data = encode([](writer &wr) { wr.write(uuid(0x0102030405060708, 0x090a0b0c0d0e0f10)); });
+    EXPECT_EQ(bytes({0xd8, int(extension_type::UUID), 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x10, 0x0f,
+                  0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09}),
+        data);
+}
+
+TEST(writer, other) {
+    EXPECT_EQ(bytes({0xc0}), encode([](writer &wr) { wr.write_nil(); }));
+    EXPECT_EQ(bytes({0xc3}), encode([](writer &wr) { wr.write_bool(true); }));
+    EXPECT_EQ(bytes({0xc2}), encode([](writer &wr) { wr.write_bool(false); }));
+    EXPECT_EQ(bytes({0x80}), encode([](writer &wr) { wr.write_map_empty(); }));
+    EXPECT_EQ(bytes({0x01, 0xa1, 'k', 0xa1, 'v'}), encode([](writer &wr) { wr.write_map({{"k", "v"}}); }));
+}
+
+TEST(writer, message) {
+    std::vector<std::byte> data;
+    buffer_adapter buffer(data);
+    write_message_to_buffer(buffer, [](writer &wr) {
+        wr.write(std::int32_t(1000));
+        wr.write_nil();
+    });
+
+    EXPECT_EQ(bytes({0x00, 0x00, 0x00, 0x04, 0xcd, 0x03, 0xe8, 0xc0}), data);
+}
@@ -20,6 +20,7 @@
 
 #include "ignite/common/detail/bytes.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 
@@ -68,6 +69,35 @@ void binary_tuple_builder::start() noexcept {
     element_index = 0;
     value_area_size = 0;
     entry_size = 0;
+    single_pass = false;
+}
+
+void binary_tuple_builder::start_single_pass() {
+    binary_tuple.clear();
+    header_hint = 0;
+
+    start_single_pass(binary_tuple);
+}
+
+void binary_tuple_builder::start_single_pass(std::vector<std::byte> &buffer) {
+    using namespace ignite::binary_tuple_common;
+
+    element_index = 0;
+    single_pass = true;
+    target = &buffer;
+    tuple_start = buffer.size();
+
+    offsets.resize(element_count);
+
+    // Lay the tuple out like the previous one, it is only moved when the guess is wrong.
+    auto value_pos = tuple_start + header_hint + HEADER_SIZE + entry_size_hint * element_count;
+    auto reserve = value_area_hint ? value_area_hint : element_count * sizeof(std::int64_t);
+
+    buffer.resize(value_pos + reserve);
+
+    value_base = buffer.data() + value_pos;
+    next_value = value_base;
+    value_area_size = tuple_size_t(reserve);
 }
 
 void binary_tuple_builder::layout() {
@@ -95,6 +125,7 @@ void binary_tuple_builder::layout() {
 
 void binary_tuple_builder::append_varlen(bytes_view bytes) {
     if (bytes.empty() || bytes.front() == binary_tuple_common::VARLEN_EMPTY_BYTE) {
+        reserve_value(tuple_size_t(bytes.size() + 1));
         *next_value++ = binary_tuple_common::VARLEN_EMPTY_BYTE;
     }
 
@@ -185,8 +216,7 @@ void binary_tuple_builder::append_int64_ptr(std::int64_t *bytes) {
 void binary_tuple_builder::append_float(float value) {
     const tuple_size_t size = gauge_float(value);
     assert(size == sizeof(float));
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     detail::bytes::store<detail::endian::LITTLE>(next_value, value);
     next_value += size;
@@ -196,8 +226,7 @@ void binary_tuple_builder::append_float(float value) {
 
 void binary_tuple_builder::append_double(double value) {
     const tuple_size_t size = gauge_double(value);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size == sizeof(float)) {
         const auto float_value = static_cast<float>(value);
@@ -214,8 +243,7 @@ void binary_tuple_builder::append_double(double value) {
 void binary_tuple_builder::append_number(const big_integer &value) {
     const tuple_size_t size = gauge_number(value);
     assert(size != 0);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     value.store_bytes(next_value);
     next_value += size;
@@ -226,8 +254,7 @@ void binary_tuple_builder::append_number(const big_integer &value) {
 void binary_tuple_builder::append_number(const big_decimal &value) {
     const tuple_size_t size = gauge_number(value);
     assert(size != 0);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     std::int16_t scale = value.get_scale();
     if (value.is_zero())
@@ -243,8 +270,7 @@ void binary_tuple_builder::append_number(const big_decimal &value) {
 void binary_tuple_builder::append_uuid(uuid value) {
     const tuple_size_t size = gauge_uuid(value);
     assert(size == 16);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     detail::bytes::store<detail::endian::LITTLE>(next_value, value.get_most_significant_bits());
     detail::bytes::store<detail::endian::LITTLE>(next_value + 8, value.get_least_significant_bits());
@@ -256,8 +282,7 @@ void binary_tuple_builder::append_uuid(uuid value) {
 void binary_tuple_builder::append_date(const ignite_date &value) {
     const tuple_size_t size = gauge_date(value);
     assert(size == 3);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     store_date(next_value, value);
     next_value += size;
@@ -268,8 +293,7 @@ void binary_tuple_builder::append_date(const ignite_date &value) {
 void binary_tuple_builder::append_time(const ignite_time &value) {
     const tuple_size_t size = gauge_time(value);
     assert(4 <= size && size <= 6);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     store_time(next_value, value, size);
     next_value += size;
@@ -280,8 +304,7 @@ void binary_tuple_builder::append_time(const ignite_time &value) {
 void binary_tuple_builder::append_date_time(const ignite_date_time &value) {
     const tuple_size_t size = gauge_date_time(value);
     assert(7 <= size && size <= 9);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     store_date(next_value, value.date());
     store_time(next_value + 3, value.time(), size - 3);
@@ -293,8 +316,7 @@ void binary_tuple_builder::append_date_time(const ignite_date_time &value) {
 void binary_tuple_builder::append_timestamp(const ignite_timestamp &value) {
     const tuple_size_t size = gauge_timestamp(value);
     assert(size == 8 || size == 12);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     detail::bytes::store<detail::endian::LITTLE>(next_value, value.get_epoch_second());
     if (size == 12) {
@@ -308,8 +330,7 @@ void binary_tuple_builder::append_timestamp(const ignite_timestamp &value) {
 void binary_tuple_builder::append_period(const ignite_period &value) {
     const tuple_size_t size = gauge_period(value);
     assert(size == 3 || size == 6 || size == 12);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     if (size == 3) {
         detail::bytes::store<detail::endian::LITTLE>(next_value, std::uint8_t(value.get_years()));
@@ -332,8 +353,7 @@ void binary_tuple_builder::append_period(const ignite_period &value) {
 void binary_tuple_builder::append_duration(const ignite_duration &value) {
     const tuple_size_t size = gauge_duration(value);
     assert(size == 8 || size == 12);
-    assert(element_index < element_count);
-    assert(next_value + size <= value_base + value_area_size);
+    reserve_value(size);
 
     detail::bytes::store<detail::endian::LITTLE>(next_value, value.get_seconds());
     if (size == 12) {
@@ -345,8 +365,7 @@ void binary_tuple_builder::append_duration(const ignite_duration &value) {
 }
 
 void binary_tuple_builder::append_bytes(bytes_view bytes) {
-    assert(element_index < element_count);
-    assert(next_value + bytes.size() <= value_base + value_area_size);
+    reserve_value(tuple_size_t(bytes.size()));
 
     if (!bytes.empty()) {
         std::memcpy(next_value, bytes.data(), bytes.size());
@@ -356,4 +375,72 @@ void binary_tuple_builder::append_bytes(bytes_view bytes) {
     append_entry();
 }
 
+void binary_tuple_builder::grow_value_area(tuple_size_t size) {
+    auto *data = target->data();
+    auto base_pos = value_base - data;
+    auto value_pos = next_value - data;
+
+    target->resize(value_pos + std::max<std::size_t>(size, value_pos - base_pos));
+
+    data = target->data();
+    value_base = data + base_pos;
+    next_value = data + value_pos;
+    value_area_size = tuple_size_t(target->size() - base_pos);
+}
+
+std::size_t binary_tuple_builder::finish(std::size_t header_size) {
+    using namespace ignite::binary_tuple_common;
+
+    assert(single_pass);
+    assert(element_index == element_count);
+
+    single_pass = false;
+
+    auto &buffer = *target;
+    value_area_size = tuple_size_t(next_value - value_base);
+
+    binary_tuple_common::header header;
+    entry_size = header.set_entry_size(value_area_size);
+
+    auto table_pos = tuple_start + header_size + HEADER_SIZE;
+    auto value_pos = table_pos + entry_size * element_count;
+    auto current_pos = std::size_t(value_base - buffer.data());
+
+    if (value_pos != current_pos) {
+        if (value_pos + value_area_size > buffer.size()) {
+            buffer.resize(value_pos + value_area_size);
+        }
+        std::memmove(buffer.data() + value_pos, buffer.data() + current_pos, value_area_size);
+    }
+    buffer.resize(value_pos + value_area_size);
+
+    auto *data = buffer.data();
+    data[table_pos - HEADER_SIZE] = header.flags;
+
+    auto *entry = data + table_pos;
+    switch (entry_size) {
+        case 1:
+            for (tuple_num_t i = 0; i < element_count; i++, entry += 1) {
+                detail::bytes::store<detail::endian::LITTLE>(entry, std::uint8_t(offsets[i]));
+            }
+            break;
+        case 2:
+            for (tuple_num_t i = 0; i < element_count; i++, entry += 2) {
+                detail::bytes::store<detail::endian::LITTLE>(entry, std::uint16_t(offsets[i]));
+            }
+            break;
+        default:
+            for (tuple_num_t i = 0; i < element_count; i++, entry += 4) {
+                detail::bytes::store<detail::endian::LITTLE>(entry, offsets[i]);
+            }
+            break;
+    }
+
+    header_hint = header_size;
+    entry_size_hint = entry_size;
+    value_area_hint = value_area_size;
+
+    return tuple_start;
+}
+
 } // namespace ignite
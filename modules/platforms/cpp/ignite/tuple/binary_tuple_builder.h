@@ -56,6 +56,13 @@ namespace ignite {
  * 4. Supply all elements again with one or more @ref append calls in the same
  *    order with the same values.
  * 5. Finally, the resulting binary tuple is obtained with the @ref build call.
+ *
+ * Alternatively a tuple can be built in a single pass. In this case the builder is
+ * initialized with the @ref start_single_pass call and all elements are supplied
+ * with @ref append calls right away. The values are written to a growable area,
+ * the offset table is written by the @ref build or @ref finish call once the value
+ * area size is known. The layout of the previous tuple is used as a guess, so
+ * reusing the builder for similar tuples avoids moving the values.
  */
 class binary_tuple_builder {
 protected:
@@ -75,6 +82,20 @@ protected:
 
     std::vector<std::byte> binary_tuple; /**< Internal buffer for tuple generation. */
 
+    bool single_pass{false}; /**< Whether the tuple is built in a single pass. */
+
+    std::vector<std::byte> *target{nullptr}; /**< Buffer the single-pass tuple is written to. */
+
+    std::size_t tuple_start{0}; /**< Position of the single-pass tuple and its header in the target buffer. */
+
+    std::vector<tuple_size_t> offsets; /**< Value offsets of the single-pass tuple. */
+
+    std::size_t header_hint{0}; /**< Size of the header in front of the previous single-pass tuple. */
+
+    tuple_size_t entry_size_hint{1}; /**< Offset table entry size of the previous single-pass tuple. */
+
+    tuple_size_t value_area_hint{0}; /**< Value area size of the previous single-pass tuple. */
+
 public:
     /**
      * @brief Constructs a new Tuple Builder object.
@@ -88,6 +109,49 @@ public:
      */
     void start() noexcept;
 
+    /**
+     * @brief Gets the number of elements in a tuple.
+     *
+     * @return Number of elements.
+     */
+    [[nodiscard]] tuple_num_t num_elements() const noexcept { return element_count; }
+
+    /**
+     * @brief Starts a new tuple which is built with append calls only.
+     */
+    void start_single_pass();
+
+    /**
+     * @brief Starts a new tuple which is built with append calls only and written to the end of the given buffer.
+     *
+     * The tuple is completed with the @ref finish call, which leaves space for a header in front of it.
+     *
+     * @param buffer Buffer to write the tuple to. Must not be modified until the tuple is finished.
+     */
+    void start_single_pass(std::vector<std::byte> &buffer);
+
+    /**
+     * @brief Gets the size of a single-pass tuple once all elements are appended.
+     *
+     * @return Tuple size in bytes.
+     */
+    [[nodiscard]] tuple_size_t get_tuple_size() const noexcept {
+        assert(single_pass);
+        auto value_size = tuple_size_t(next_value - value_base);
+        return binary_tuple_common::HEADER_SIZE + (1u << binary_tuple_common::size_to_flags(value_size)) * element_count
+            + value_size;
+    }
+
+    /**
+     * @brief Finalizes a single-pass tuple written to a buffer.
+     *
+     * The tuple is placed right after a header of the specified size. The header itself is written by the caller.
+     *
+     * @param header_size Size of the header in front of the tuple.
+     * @return Position of the header in the buffer.
+     */
+    std::size_t finish(std::size_t header_size);
+
     /**
      * @brief Assigns a null value for the next element.
      */
@@ -424,6 +488,9 @@ public:
      */
     const std::vector<std::byte> &build() {
         assert(element_index == element_count);
+        if (single_pass) {
+            finish(0);
+        }
         return binary_tuple;
     }
 
@@ -645,6 +712,26 @@ private:
         element_index++;
     }
 
+    /**
+     * @brief Makes sure there is space for the next value.
+     *
+     * @param size Required size for the value.
+     */
+    void reserve_value(tuple_size_t size) {
+        assert(element_index < element_count);
+        if (single_pass && next_value + size > value_base + value_area_size) {
+            grow_value_area(size);
+        }
+        assert(next_value + size <= value_base + value_area_size);
+    }
+
+    /**
+     * @brief Grows the value area in the single-pass mode.
+     *
+     * @param size Required size for the next value.
+     */
+    void grow_value_area(tuple_size_t size);
+
     /**
      * @brief Writes binary value of specified element.
      *
@@ -656,6 +743,11 @@ private:
      * @brief Adds an entry to the offset table.
      */
     void append_entry() {
+        if (single_pass) {
+            offsets[element_index++] = tuple_size_t(next_value - value_base);
+            return;
+        }
+
         auto offset = detail::bytes::htol<std::ptrdiff_t>(next_value - value_base);
         std::memcpy(next_entry, &offset, entry_size);
         next_entry += entry_size;
@@ -130,6 +130,34 @@ bytes_view binary_tuple_parser::get_next() {
     return {};
 }
 
+bytes_view binary_tuple_parser::get_element(tuple_num_t index) const {
+    assert(index >= 0 && index < num_elements());
+
+    const std::byte *table = binary_tuple.data() + binary_tuple_common::HEADER_SIZE;
+    const std::byte *entry = table + std::size_t(index) * entry_size;
+
+    // Load the element end offset and the end offset of the previous element (little-endian).
+    std::uint64_t le_end = 0;
+    memcpy(&le_end, entry, entry_size);
+
+    std::uint64_t le_begin = 0;
+    if (index > 0) {
+        memcpy(&le_begin, entry - entry_size, entry_size);
+    }
+
+    auto begin = detail::bytes::ltoh(le_begin);
+    auto end = detail::bytes::ltoh(le_end);
+    if (begin > end || value_base + end > binary_tuple.data() + binary_tuple.size()) {
+        throw std::out_of_range("Invalid binary tuple offset table");
+    }
+
+    if (std::size_t length = end - begin) {
+        return {value_base + begin, length};
+    }
+
+    return {};
+}
+
 bytes_view binary_tuple_parser::get_varlen(bytes_view bytes) {
     switch (bytes.size()) {
         default:
@@ -101,6 +101,18 @@ public:
      */
     bytes_view get_next();
 
+    /**
+     * @brief Gets the value of the element with the specified index.
+     *
+     * The element is located with the offset table in constant time, so this
+     * can be used to pick a few columns out of a wide tuple. It does not affect
+     * the position of @ref get_next().
+     *
+     * @param index Element index.
+     * @return The element value.
+     */
+    bytes_view get_element(tuple_num_t index) const;
+
     /**
      * @brief Reads value of a variable-length element.
      *
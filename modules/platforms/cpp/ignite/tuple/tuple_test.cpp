@@ -430,6 +430,113 @@ TEST(tuple, AllTypesExtended) {
     }
 }
 
+TEST(tuple, SinglePassMatchesTwoPass) { // NOLINT(cert-err58-cpp)
+    static constexpr tuple_num_t NUM_ELEMENTS = 7;
+
+    binary_tuple_builder two_pass(NUM_ELEMENTS);
+    binary_tuple_builder single_pass(NUM_ELEMENTS);
+
+    // Value area sizes which need offset table entries of one, two and four bytes.
+    for (std::size_t len : {0, 1, 100, 300, 70'000}) {
+        std::string str(len, 'x');
+        big_decimal dec("-12345.6789");
+        ignite_time time(1, 2, 3, 4000);
+
+        two_pass.start();
+        two_pass.claim_int64(std::int64_t(len));
+        two_pass.claim_varlen(str);
+        two_pass.claim_null();
+        two_pass.claim_number(dec);
+        two_pass.claim_double(0.5);
+        two_pass.claim_time(time);
+        two_pass.claim_varlen("\x80"s);
+        two_pass.layout();
+        two_pass.append_int64(std::int64_t(len));
+        two_pass.append_varlen(str);
+        two_pass.append_null();
+        two_pass.append_number(dec);
+        two_pass.append_double(0.5);
+        two_pass.append_time(time);
+        two_pass.append_varlen("\x80"s);
+
+        single_pass.start_single_pass();
+        single_pass.append_int64(std::int64_t(len));
+        single_pass.append_varlen(str);
+        single_pass.append_null();
+        single_pass.append_number(dec);
+        single_pass.append_double(0.5);
+        single_pass.append_time(time);
+        single_pass.append_varlen("\x80"s);
+
+        const auto &expected = two_pass.build();
+        const auto &actual = single_pass.build();
+        EXPECT_EQ(expected, actual) << "len=" << len;
+
+        binary_tuple_parser tp(NUM_ELEMENTS, actual);
+        EXPECT_EQ(std::int64_t(len), get_value<int64_t>(tp.get_next()));
+        EXPECT_EQ(str, get_value<std::string>(tp.get_next()));
+        EXPECT_TRUE(tp.get_next().empty());
+        EXPECT_EQ(dec, get_value<big_decimal>(tp.get_next()));
+        EXPECT_EQ(0.5, get_value<double>(tp.get_next()));
+        EXPECT_EQ(time, get_value<ignite_time>(tp.get_next()));
+        EXPECT_EQ("\x80"s, get_value<std::string>(tp.get_next()));
+    }
+}
+
+TEST(tuple, SinglePassNullsOnly) { // NOLINT(cert-err58-cpp)
+    static constexpr tuple_num_t NUM_ELEMENTS = 3;
+
+    binary_tuple_builder tb(NUM_ELEMENTS);
+
+    tb.start_single_pass();
+    tb.append_null();
+    tb.append_null();
+    tb.append_null();
+
+    const auto &binary_tuple = tb.build();
+    EXPECT_EQ(std::vector<std::byte>(binary_tuple_common::HEADER_SIZE + NUM_ELEMENTS), binary_tuple);
+}
+
+TEST(tuple, RandomAccessMatchesSequential) { // NOLINT(cert-err58-cpp)
+    static constexpr tuple_num_t NUM_ELEMENTS = 250;
+
+    // Wide enough values make the offset table use 2- and 4-byte entries.
+    for (std::size_t value_len : {std::size_t(0), std::size_t(1), std::size_t(300), std::size_t(70000)}) {
+        binary_tuple_builder tb(NUM_ELEMENTS);
+        tb.start_single_pass();
+
+        for (tuple_num_t i = 0; i < NUM_ELEMENTS; ++i) {
+            if (i % 7 == 0) {
+                tb.append_null();
+            } else if (i % 2 == 0) {
+                tb.append_int32(i);
+            } else {
+                tb.append_varlen(std::string(i == NUM_ELEMENTS - 1 ? value_len : std::size_t(i % 5), 'x'));
+            }
+        }
+
+        const auto &binary_tuple = tb.build();
+        binary_tuple_parser tp(NUM_ELEMENTS, binary_tuple);
+
+        std::vector<bytes_view> sequential;
+        for (tuple_num_t i = 0; i < NUM_ELEMENTS; ++i) {
+            sequential.push_back(tp.get_next());
+        }
+
+        // Random access neither depends on nor moves the sequential position.
+        for (tuple_num_t i = NUM_ELEMENTS - 1; i >= 0; --i) {
+            auto element = tp.get_element(i);
+            EXPECT_EQ(sequential[i].data(), element.data());
+            EXPECT_EQ(sequential[i].size(), element.size());
+        }
+        EXPECT_EQ(NUM_ELEMENTS, tp.num_parsed_elements());
+
+        EXPECT_EQ(40, binary_tuple_parser::get_int32(tp.get_element(40)));
+        EXPECT_TRUE(tp.get_element(0).empty());
+        EXPECT_EQ(value_len, binary_tuple_parser::get_varlen(tp.get_element(NUM_ELEMENTS - 1)).size());
+    }
+}
+
 TEST(tuple, TwoFixedValues) { // NOLINT(cert-err58-cpp)
     {
         auto values = std::make_tuple<int32_t, int32_t>(33, -71);
@@ -24,6 +24,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <future>
 #include <limits>
 
 using namespace ignite;
@@ -572,3 +573,35 @@ TEST_F(compute_test, job_execution_change_priority) {
 
     EXPECT_EQ(res, job_execution::operation_result::INVALID_STATE);
 }
+
+TEST_F(compute_test, job_result_callback_executor) {
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+    cfg.set_callback_executor(callback_executor::make_thread_pool(2));
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    const std::int32_t sleep_ms = 500;
+
+    auto nodes = client.get_cluster_nodes();
+    auto execution = client.get_compute().submit(job_target::any_node(nodes), m_sleep_job, {sleep_ms});
+
+    std::promise<bool> nested;
+    execution.get_result_async([&client, &nested](ignite_result<std::optional<binary_object>> res) {
+        if (res.has_error()) {
+            nested.set_exception(std::make_exception_ptr(res.error()));
+            return;
+        }
+
+        // The callback is not invoked on the IO thread, so it may block on another request.
+        nested.set_value(!client.get_cluster_nodes().empty());
+    });
+
+    auto fut = nested.get_future();
+    ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(10)));
+    EXPECT_TRUE(fut.get());
+
+    auto state = execution.get_state();
+    ASSERT_TRUE(state.has_value());
+    EXPECT_EQ(job_status::COMPLETED, state->status);
+}
@@ -0,0 +1,309 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite_runner_suite.h"
+#include "tests/test-common/test_utils.h"
+
+#include "ignite/client/ignite_client.h"
+#include "ignite/client/ignite_client_configuration.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+using namespace ignite;
+
+/**
+ * Test table type mapping (@see ignite_runner_suite::TABLE_1).
+ */
+struct streamer_test_type {
+    streamer_test_type() = default;
+
+    explicit streamer_test_type(std::int64_t key, std::string val)
+        : key(key)
+        , val(std::move(val)) {}
+
+    std::int64_t key{0};
+    std::string val;
+};
+
+namespace ignite {
+
+template<>
+ignite_tuple convert_to_tuple(streamer_test_type &&value) {
+    ignite_tuple tuple;
+
+    tuple.set("key", value.key);
+    tuple.set("val", value.val);
+
+    return tuple;
+}
+
+template<>
+ignite_tuple convert_to_tuple(const streamer_test_type &value) {
+    ignite_tuple tuple;
+
+    tuple.set("key", value.key);
+    tuple.set("val", value.val);
+
+    return tuple;
+}
+
+template<>
+streamer_test_type convert_from_tuple(ignite_tuple &&value) {
+    streamer_test_type res;
+
+    res.key = value.get<std::int64_t>("key");
+    res.val = value.get<std::string>("val");
+
+    return res;
+}
+
+} // namespace ignite
+
+/**
+ * Test suite.
+ */
+class data_streamer_test : public ignite_runner_suite {
+protected:
+    void SetUp() override {
+        ignite_client_configuration cfg{get_node_addrs()};
+        cfg.set_logger(get_logger());
+
+        m_client = ignite_client::start(cfg, std::chrono::seconds(30));
+        auto table = m_client.get_tables().get_table(TABLE_1);
+
+        tuple_view = table->get_record_binary_view();
+        view = table->get_record_view<streamer_test_type>();
+    }
+
+    void TearDown() override { clear_table1(); }
+
+    /**
+     * Check that records with keys in the range are present in the table.
+     *
+     * @param begin Beginning of the range.
+     * @param end End of the range.
+     */
+    void check_range(std::int64_t begin, std::int64_t end) {
+        for (auto i = begin; i < end; ++i) {
+            auto res = tuple_view.get(nullptr, get_tuple(i));
+
+            ASSERT_TRUE(res.has_value()) << "key=" << i;
+            EXPECT_EQ("val" + std::to_string(i), res->get<std::string>("val"));
+        }
+    }
+
+    /** Ignite client. */
+    ignite_client m_client;
+
+    /** Record binary view. */
+    record_view<ignite_tuple> tuple_view;
+
+    /** Record view. */
+    record_view<streamer_test_type> view;
+};
+
+TEST_F(data_streamer_test, add_close) {
+    data_streamer_options options;
+    options.set_page_size(7);
+
+    auto streamer = tuple_view.create_data_streamer(options);
+    for (std::int64_t i = 0; i < 100; ++i)
+        streamer.add(get_tuple(i, "val" + std::to_string(i)));
+
+    streamer.close();
+
+    check_range(0, 100);
+}
+
+TEST_F(data_streamer_test, flush_sends_incomplete_batches) {
+    auto streamer = tuple_view.create_data_streamer();
+    for (std::int64_t i = 0; i < 10; ++i)
+        streamer.add(get_tuple(i, "val" + std::to_string(i)));
+
+    streamer.flush();
+
+    check_range(0, 10);
+
+    streamer.close();
+}
+
+TEST_F(data_streamer_test, auto_flush) {
+    data_streamer_options options;
+    options.set_auto_flush_interval(std::chrono::milliseconds(100));
+
+    auto streamer = tuple_view.create_data_streamer(options);
+    streamer.add(get_tuple(1, "val1"));
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    check_range(1, 2);
+
+    streamer.close();
+}
+
+TEST_F(data_streamer_test, remove) {
+    for (std::int64_t i = 0; i < 10; ++i)
+        tuple_view.upsert(nullptr, get_tuple(i, "val" + std::to_string(i)));
+
+    auto streamer = tuple_view.create_data_streamer();
+    for (std::int64_t i = 0; i < 10; i += 2)
+        streamer.add(get_tuple(i), data_streamer_operation_type::REMOVE);
+
+    streamer.close();
+
+    for (std::int64_t i = 0; i < 10; ++i)
+        EXPECT_EQ(i % 2 != 0, tuple_view.get(nullptr, get_tuple(i)).has_value()) << "key=" << i;
+}
+
+TEST_F(data_streamer_test, operations_order_is_preserved_within_partition) {
+    data_streamer_options options;
+    options.set_page_size(1);
+
+    auto streamer = tuple_view.create_data_streamer(options);
+    streamer.add(get_tuple(1, "val0"));
+    streamer.add(get_tuple(1), data_streamer_operation_type::REMOVE);
+    streamer.add(get_tuple(1, "val1"));
+    streamer.close();
+
+    check_range(1, 2);
+}
+
+TEST_F(data_streamer_test, add_in_callback_throws_instead_of_blocking) {
+    data_streamer_options options;
+    options.set_page_size(1);
+    options.set_per_node_parallel_operations(1);
+
+    auto streamer = tuple_view.create_data_streamer(options);
+
+    // With a single row per batch and a batch in flight, the buffer of the partition fills up after two rows.
+    std::promise<std::string> error;
+    tuple_view.get_async(nullptr, get_tuple(1), [&](ignite_result<std::optional<ignite_tuple>> &&) {
+        try {
+            for (std::int64_t i = 0; i < 10; ++i)
+                streamer.add(get_tuple(1, "val" + std::to_string(i)));
+
+            error.set_value({});
+        } catch (const ignite_error &e) {
+            error.set_value(e.what_str());
+        }
+    });
+
+    auto future = error.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+    EXPECT_NE(std::string::npos, future.get().find("buffer of the partition is full"));
+
+    streamer.close();
+}
+
+TEST_F(data_streamer_test, add_after_close_throws) {
+    auto streamer = tuple_view.create_data_streamer();
+    streamer.close();
+
+    EXPECT_THROW(
+        {
+            try {
+                streamer.add(get_tuple(1, "val1"));
+            } catch (const ignite_error &e) {
+                EXPECT_STREQ("Data streamer is closed", e.what());
+                throw;
+            }
+        },
+        ignite_error);
+}
+
+TEST_F(data_streamer_test, invalid_options_throw) {
+    data_streamer_options options;
+    options.set_page_size(0);
+
+    EXPECT_THROW(
+        {
+            try {
+                (void) tuple_view.create_data_streamer(options);
+            } catch (const ignite_error &e) {
+                EXPECT_STREQ("Page size must be positive: 0", e.what());
+                throw;
+            }
+        },
+        ignite_error);
+}
+
+TEST_F(data_streamer_test, invalid_tuple_fails_streamer) {
+    auto streamer = tuple_view.create_data_streamer();
+
+    auto tuple = get_tuple(1, "val1");
+    tuple.set("extra", std::string("some value"));
+    streamer.add(tuple);
+
+    EXPECT_THROW(streamer.close(), ignite_error);
+    EXPECT_THROW(streamer.add(get_tuple(2, "val2")), ignite_error);
+}
+
+TEST_F(data_streamer_test, stream_data_from_source) {
+    data_streamer_options options;
+    options.set_page_size(10);
+
+    std::int64_t next = 0;
+    tuple_view.stream_data(
+        [&next]() -> std::optional<ignite_tuple> {
+            if (next >= 1000)
+                return std::nullopt;
+
+            auto key = next++;
+            return get_tuple(key, "val" + std::to_string(key));
+        },
+        options);
+
+    check_range(0, 1000);
+}
+
+TEST_F(data_streamer_test, stream_data_source_error) {
+    EXPECT_THROW(
+        {
+            try {
+                tuple_view.stream_data([]() -> std::optional<ignite_tuple> { throw ignite_error("Test error"); });
+            } catch (const ignite_error &e) {
+                EXPECT_STREQ("Test error", e.what());
+                throw;
+            }
+        },
+        ignite_error);
+}
+
+TEST_F(data_streamer_test, mapped_type) {
+    auto streamer = view.create_data_streamer();
+    for (std::int64_t i = 0; i < 100; ++i)
+        streamer.add(streamer_test_type(i, "val" + std::to_string(i)));
+
+    streamer.close();
+
+    check_range(0, 100);
+
+    std::int64_t next = 100;
+    view.stream_data([&next]() -> std::optional<streamer_test_type> {
+        if (next >= 200)
+            return std::nullopt;
+
+        auto key = next++;
+        return streamer_test_type(key, "val" + std::to_string(key));
+    });
+
+    check_range(100, 200);
+}
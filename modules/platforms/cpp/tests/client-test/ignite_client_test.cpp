@@ -16,6 +16,9 @@
  */
 
 #include "ignite_runner_suite.h"
+#ifndef _WIN32
+# include "tcp_proxy.h"
+#endif
 
 #include <ignite/client/basic_authenticator.h>
 #include <ignite/client/ignite_client.h>
@@ -23,7 +26,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 using namespace ignite;
 
@@ -32,6 +42,70 @@ using namespace ignite;
  */
 class client_test : public ignite_runner_suite {};
 
+/**
+ * Logger recording the messages, so the tests can observe the client behaviour.
+ */
+class recording_logger : public gtest_logger {
+public:
+    /**
+     * Constructor.
+     */
+    recording_logger()
+        : gtest_logger(false, true) {}
+
+    void log_error(std::string_view message) override {
+        record(message);
+        gtest_logger::log_error(message);
+    }
+
+    void log_warning(std::string_view message) override {
+        record(message);
+        gtest_logger::log_warning(message);
+    }
+
+    void log_info(std::string_view message) override {
+        record(message);
+        gtest_logger::log_info(message);
+    }
+
+    void log_debug(std::string_view message) override {
+        record(message);
+        gtest_logger::log_debug(message);
+    }
+
+    /**
+     * Check whether a message starting with the prefix and containing the fragment was logged.
+     *
+     * @param prefix Message prefix.
+     * @param fragment Message fragment.
+     * @return @c true if such a message was logged.
+     */
+    [[nodiscard]] bool has_message(std::string_view prefix, std::string_view fragment = {}) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return std::any_of(m_messages.begin(), m_messages.end(), [&](const std::string &msg) {
+            return msg.compare(0, prefix.size(), prefix) == 0 && msg.find(fragment, prefix.size()) != std::string::npos;
+        });
+    }
+
+private:
+    /**
+     * Record the message.
+     *
+     * @param message Message.
+     */
+    void record(std::string_view message) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_messages.emplace_back(message);
+    }
+
+    /** Messages. */
+    std::vector<std::string> m_messages;
+
+    /** Messages mutex. */
+    mutable std::mutex m_mutex;
+};
+
 TEST_F(client_test, get_configuration) {
     ignite_client_configuration cfg{get_node_addrs()};
     cfg.set_logger(get_logger());
@@ -43,4 +117,218 @@ TEST_F(client_test, get_configuration) {
 
     EXPECT_EQ(cfg.get_endpoints(), cfg2.get_endpoints());
     EXPECT_EQ(cfg.get_connection_limit(), cfg2.get_connection_limit());
-}
\ No newline at end of file
+}
+
+#ifndef _WIN32
+TEST_F(client_test, operation_timeout) {
+    tcp_proxy proxy(get_node_addrs().front());
+
+    ignite_client_configuration cfg{proxy.get_address()};
+    cfg.set_logger(get_logger());
+    cfg.set_operation_timeout(std::chrono::milliseconds(500));
+
+    retry_policy no_retries;
+    no_retries.set_retry_limit(0);
+    cfg.set_retry_policy(no_retries);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    // Completed requests do not expire.
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FALSE(client.get_tables().get_tables().empty());
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    proxy.set_responses_paused(true);
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        (void) client.get_tables().get_tables();
+        FAIL() << "Request is expected to time out";
+    } catch (const ignite_error &err) {
+        EXPECT_EQ(error::code::CONNECTION, err.get_status_code());
+        EXPECT_EQ("Operation timed out", err.what_str());
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(500));
+    EXPECT_LT(elapsed, std::chrono::seconds(5));
+
+    // The connection is still usable once the node responds again.
+    proxy.set_responses_paused(false);
+    EXPECT_FALSE(client.get_tables().get_tables().empty());
+}
+
+TEST_F(client_test, operation_timeout_bounds_retries) {
+    tcp_proxy proxy(get_node_addrs().front());
+
+    // The default retry policy retries the timed out reads.
+    ignite_client_configuration cfg{proxy.get_address()};
+    cfg.set_logger(get_logger());
+    cfg.set_operation_timeout(std::chrono::seconds(1));
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+    EXPECT_FALSE(client.get_tables().get_tables().empty());
+
+    proxy.set_responses_paused(true);
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        (void) client.get_tables().get_tables();
+        FAIL() << "Request is expected to time out";
+    } catch (const ignite_error &err) {
+        EXPECT_EQ(error::code::CONNECTION, err.get_status_code());
+    }
+
+    // The retries share the timeout of the operation.
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::seconds(1));
+    EXPECT_LT(elapsed, std::chrono::seconds(2));
+
+    proxy.set_responses_paused(false);
+    EXPECT_FALSE(client.get_tables().get_tables().empty());
+}
+
+TEST_F(client_test, heartbeat_timeout_closes_connection) {
+    tcp_proxy proxy(get_node_addrs().front());
+
+    ignite_client_configuration cfg{proxy.get_address()};
+    cfg.set_logger(get_logger());
+    cfg.set_heartbeat_interval(std::chrono::milliseconds(200));
+    cfg.set_heartbeat_timeout(std::chrono::milliseconds(500));
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    // Heartbeats are answered, so the idle connection is kept.
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    EXPECT_EQ(1, proxy.get_accepted());
+    EXPECT_EQ(1, proxy.get_active());
+
+    proxy.set_responses_paused(true);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (proxy.get_accepted() == 1 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The client closed the connection which stopped responding to heartbeats and connected again.
+    EXPECT_GT(proxy.get_accepted(), 1);
+
+    proxy.set_responses_paused(false);
+    EXPECT_FALSE(client.get_tables().get_tables().empty());
+}
+
+TEST_F(client_test, retry_uses_other_connection) {
+    tcp_proxy stalled(get_node_addrs().front());
+    tcp_proxy healthy(get_node_addrs().front());
+
+    // The default retry policy retries the reads which failed because the connection was closed.
+    ignite_client_configuration cfg{stalled.get_address(), healthy.get_address()};
+    cfg.set_logger(get_logger());
+    cfg.set_balancing_policy(balancing_policy::ROUND_ROBIN);
+    cfg.set_heartbeat_interval(std::chrono::milliseconds(200));
+    cfg.set_heartbeat_timeout(std::chrono::milliseconds(500));
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (healthy.get_active() == 0 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    ASSERT_EQ(1, stalled.get_active());
+    ASSERT_EQ(1, healthy.get_active());
+
+    stalled.set_responses_paused(true);
+
+    // The requests sent over the stalled connection are retried over the other one.
+    for (int i = 0; i < 4; ++i)
+        EXPECT_FALSE(client.get_tables().get_tables().empty());
+}
+
+TEST_F(client_test, connections_per_node) {
+    tcp_proxy proxy(get_node_addrs().front());
+
+    ignite_client_configuration cfg{proxy.get_address()};
+    cfg.set_logger(get_logger());
+    cfg.set_connections_per_node(3);
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    // The client starts once the first connection is established, the others follow in the background.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (proxy.get_active() < 3 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    EXPECT_EQ(3, proxy.get_active());
+
+    for (int i = 0; i < 10; ++i)
+        EXPECT_FALSE(client.get_tables().get_tables().empty());
+
+    // No more connections are opened to the node than configured.
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_EQ(3, proxy.get_accepted());
+    EXPECT_EQ(3, proxy.get_active());
+}
+#endif
+
+TEST_F(client_test, topology_discovery) {
+    auto addrs = get_node_addrs();
+
+    // Discovery can only be observed with several nodes.
+    if (addrs.size() < 2)
+        return;
+
+    auto logger = std::make_shared<recording_logger>();
+
+    ignite_client_configuration cfg{addrs.front()};
+    cfg.set_logger(logger);
+    cfg.set_topology_discovery_enabled(true);
+    cfg.set_topology_refresh_interval(std::chrono::milliseconds(500));
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    // The node is not listed, so it is only connected if its client connector address was discovered.
+    auto unlisted_port = addrs[1].substr(addrs[1].rfind(':'));
+    auto connected = [&] { return logger->has_message("Established connection with remote host ", unlisted_port); };
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!connected() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    ASSERT_TRUE(connected());
+
+    // Give the handshake on the discovered connection time to complete and verify the node.
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    EXPECT_FALSE(logger->has_message("Failed to establish connection with remote host ", unlisted_port + ","));
+    EXPECT_FALSE(logger->has_message("Node ", unlisted_port));
+
+    auto nodes = client.get_cluster_nodes();
+    EXPECT_GE(nodes.size(), 2);
+}
+
+TEST_F(client_test, callback_executor) {
+    ignite_client_configuration cfg{get_node_addrs()};
+    cfg.set_logger(get_logger());
+
+    EXPECT_FALSE(cfg.get_callback_executor());
+
+    cfg.set_callback_executor(callback_executor::make_thread_pool(2));
+
+    auto client = ignite_client::start(cfg, std::chrono::seconds(30));
+
+    std::promise<bool> nested;
+    client.get_tables().get_tables_async([&client, &nested](ignite_result<std::vector<table>> res) {
+        if (res.has_error()) {
+            nested.set_exception(std::make_exception_ptr(res.error()));
+            return;
+        }
+
+        // The callback is not invoked on the IO thread, so it may block on another request.
+        auto tables = client.get_tables().get_tables();
+        nested.set_value(!tables.empty());
+    });
+
+    auto fut = nested.get_future();
+    ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(10)));
+    EXPECT_TRUE(fut.get());
+}
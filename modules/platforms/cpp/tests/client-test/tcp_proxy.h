@@ -0,0 +1,277 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements. See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <ignite/common/ignite_error.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace ignite {
+
+/**
+ * TCP proxy forwarding the connections to a node. Lets tests observe and disrupt the traffic of the client.
+ */
+class tcp_proxy {
+public:
+    /**
+     * Constructor. Starts listening on a random local port.
+     *
+     * @param target Address of the node in the host:port form.
+     */
+    explicit tcp_proxy(const std::string &target) {
+        auto colon = target.rfind(':');
+        m_target_host = target.substr(0, colon);
+        m_target_port = target.substr(colon + 1);
+
+        m_listener = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_listener < 0)
+            throw ignite_error("Failed to create proxy socket");
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+
+        socklen_t len = sizeof(addr);
+        if (bind(m_listener, reinterpret_cast<sockaddr *>(&addr), len) != 0 || listen(m_listener, 16) != 0
+            || getsockname(m_listener, reinterpret_cast<sockaddr *>(&addr), &len) != 0) {
+            close(m_listener);
+            throw ignite_error("Failed to start proxy listener");
+        }
+
+        m_port = ntohs(addr.sin_port);
+        m_thread = std::thread(&tcp_proxy::run, this);
+    }
+
+    /**
+     * Destructor. Closes all the connections.
+     */
+    ~tcp_proxy() {
+        m_stopping = true;
+        m_thread.join();
+
+        for (auto &conn : m_connections) {
+            close(conn.client);
+            close(conn.server);
+        }
+
+        close(m_listener);
+    }
+
+    tcp_proxy(const tcp_proxy &) = delete;
+    tcp_proxy &operator=(const tcp_proxy &) = delete;
+
+    /**
+     * Get the address to connect to instead of the node.
+     *
+     * @return Address in the host:port form.
+     */
+    [[nodiscard]] std::string get_address() const { return "127.0.0.1:" + std::to_string(m_port); }
+
+    /**
+     * Stop or resume forwarding the data sent by the node. The data sent by the client is still forwarded, and
+     * the connections closed by the client are still noticed.
+     *
+     * @param paused Whether the responses are held back.
+     */
+    void set_responses_paused(bool paused) { m_paused = paused; }
+
+    /**
+     * Get the number of connections accepted since the proxy was started.
+     *
+     * @return Number of accepted connections.
+     */
+    [[nodiscard]] std::size_t get_accepted() const { return m_accepted; }
+
+    /**
+     * Get the number of connections which are currently open.
+     *
+     * @return Number of open connections.
+     */
+    [[nodiscard]] std::size_t get_active() const { return m_active; }
+
+private:
+    /**
+     * Proxied connection.
+     */
+    struct connection {
+        /** Socket of the client. */
+        int client;
+
+        /** Socket of the node. */
+        int server;
+    };
+
+    /**
+     * Run the proxy loop.
+     */
+    void run() {
+        std::vector<pollfd> fds;
+        while (!m_stopping) {
+            bool paused = m_paused;
+
+            fds.clear();
+            fds.push_back({m_listener, POLLIN, 0});
+            for (auto &conn : m_connections) {
+                fds.push_back({conn.client, POLLIN, 0});
+                fds.push_back({conn.server, short(paused ? 0 : POLLIN), 0});
+            }
+
+            int res = poll(fds.data(), fds.size(), 50);
+            if (res <= 0)
+                continue;
+
+            // Connections accepted below are polled starting with the next iteration.
+            auto polled = m_connections.size();
+            if (fds[0].revents & POLLIN)
+                accept_connection();
+
+            std::vector<std::size_t> closed;
+            for (std::size_t i = 0; i < polled; ++i) {
+                auto &conn = m_connections[i];
+                bool ok = true;
+                if (fds[1 + i * 2].revents)
+                    ok = forward(conn.client, conn.server);
+
+                if (ok && fds[2 + i * 2].revents)
+                    ok = forward(conn.server, conn.client);
+
+                if (!ok)
+                    closed.push_back(i);
+            }
+
+            for (auto it = closed.rbegin(); it != closed.rend(); ++it) {
+                close(m_connections[*it].client);
+                close(m_connections[*it].server);
+                m_connections.erase(m_connections.begin() + std::ptrdiff_t(*it));
+                --m_active;
+            }
+        }
+    }
+
+    /**
+     * Accept a connection and connect to the node on its behalf.
+     */
+    void accept_connection() {
+        int client = accept(m_listener, nullptr, nullptr);
+        if (client < 0)
+            return;
+
+        ++m_accepted;
+
+        int server = connect_to_target();
+        if (server < 0) {
+            close(client);
+            return;
+        }
+
+        m_connections.push_back({client, server});
+        ++m_active;
+    }
+
+    /**
+     * Connect to the node.
+     *
+     * @return Socket, or -1 on failure.
+     */
+    [[nodiscard]] int connect_to_target() const {
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo *info = nullptr;
+        if (getaddrinfo(m_target_host.c_str(), m_target_port.c_str(), &hints, &info) != 0 || !info)
+            return -1;
+
+        int fd = socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+        if (fd >= 0 && connect(fd, info->ai_addr, info->ai_addrlen) != 0) {
+            close(fd);
+            fd = -1;
+        }
+
+        freeaddrinfo(info);
+        return fd;
+    }
+
+    /**
+     * Forward the available data.
+     *
+     * @param from Socket to read from.
+     * @param to Socket to write to.
+     * @return @c false if the connection is closed.
+     */
+    static bool forward(int from, int to) {
+        char buf[0x4000];
+        auto received = recv(from, buf, sizeof(buf), 0);
+        if (received <= 0)
+            return false;
+
+        for (ssize_t sent = 0; sent < received;) {
+            auto res = send(to, buf + sent, std::size_t(received - sent), MSG_NOSIGNAL);
+            if (res <= 0)
+                return false;
+
+            sent += res;
+        }
+
+        return true;
+    }
+
+    /** Target host. */
+    std::string m_target_host;
+
+    /** Target port. */
+    std::string m_target_port;
+
+    /** Listening socket. */
+    int m_listener{-1};
+
+    /** Listening port. */
+    std::uint16_t m_port{0};
+
+    /** Connections. Accessed by the proxy thread only. */
+    std::vector<connection> m_connections;
+
+    /** Whether the responses are held back. */
+    std::atomic_bool m_paused{false};
+
+    /** Number of accepted connections. */
+    std::atomic_size_t m_accepted{0};
+
+    /** Number of open connections. */
+    std::atomic_size_t m_active{0};
+
+    /** Stop flag. */
+    std::atomic_bool m_stopping{false};
+
+    /** Proxy thread. */
+    std::thread m_thread;
+};
+
+} // namespace ignite
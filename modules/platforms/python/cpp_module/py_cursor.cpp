@@ -444,15 +444,15 @@ static PyObject* py_cursor_fetchone(py_cursor* self, PyObject*)
         return nullptr;
     }
 
-    auto row = query0.get_current_row();
-    auto res_list = PyTuple_New(row.size());
+    auto row_size = query0.get_current_row_size();
+    auto res_list = PyTuple_New(row_size);
     if (!res_list) {
         PyErr_SetString(py_get_module_operational_error_class(), "Can not allocate a new list for the result set");
         return nullptr;
     }
 
-    for (std::size_t i = 0; i < row.size(); ++i) {
-        auto py_column = primitive_to_pyobject(row[i]);
+    for (std::size_t i = 0; i < row_size; ++i) {
+        auto py_column = primitive_to_pyobject(query0.get_current_value(i));
         if (!py_column) {
             Py_DECREF(res_list);
             return nullptr;